@@ -1,42 +1,375 @@
-#include <chrono>
+// Benchmark suite for the C++ Forword, built on Google Benchmark.
+//
+//   ./forword_bench                                    # console table
+//   ./forword_bench --benchmark_format=json > out.json # for regression checks
+//   ./forword_bench --benchmark_filter='Replace/100000/'
+//
+// Synthetic dictionaries draw words from the letters a-p and fill messages
+// with the letters q-z, so the match density of a message is exact.
+// Argument order: dictionary words / message bytes / match density (%).
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
-#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
 #include "../forword.h"
 
-int main() {
-    // Create forbidden words file
-    const char* forbidden_words_file = "forbidden_words.txt";
-    std::ofstream file(forbidden_words_file);
-    file << "bad\nbadword\n나쁜말\n욕설";
-    file.close();
-
-    // Initialize Forword
-    Forword forword(forbidden_words_file);
-
-    // Prepare test text
-    const std::string text = "이것은 나쁜말 입니다. This is a bad word. 여기에 욕설이 있습니다.";
-
-    // Benchmark replace operation
-    const int iterations = 10000;
-    auto start = std::chrono::high_resolution_clock::now();
-    
-    for (int i = 0; i < iterations; i++) {
-        forword.replace(text);
-    }
-    
-    auto end = std::chrono::high_resolution_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-    double elapsed_sec = elapsed.count() / 1000.0;
-    double ops_per_sec = iterations / elapsed_sec;
-
-    std::cout << "C++ Forword Benchmark\n";
-    std::cout << "---------------------\n";
-    std::cout << "Operations: " << iterations << "\n";
-    std::cout << "Total time: " << elapsed_sec << " seconds\n";
-    std::cout << "Ops/sec: " << ops_per_sec << "\n";
-
-    // Cleanup
-    std::remove(forbidden_words_file);
+#ifndef FORWORD_SAMPLE_DATA_DIR
+#define FORWORD_SAMPLE_DATA_DIR "sample_data"
+#endif
+
+namespace {
+
+// A file under the temp directory, removed when it goes out of scope.
+class TempFile {
+public:
+    explicit TempFile(const std::string& name)
+        : path_((std::filesystem::temp_directory_path() / ("forword_bench_" + name)).string()) {}
+
+    ~TempFile() {
+        std::error_code error;
+        std::filesystem::remove(path_, error);
+    }
+
+    TempFile(const TempFile&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+
+    const std::string& path() const { return path_; }
+
+private:
+    std::string path_;
+};
+
+void write_words(const TempFile& file, const std::vector<std::string>& words) {
+    std::ofstream out(file.path(), std::ios::binary);
+    for (const auto& word : words) {
+        out << word << '\n';
+    }
+}
+
+std::vector<std::string> split_code_points(const std::string& text) {
+    std::vector<std::string> chars;
+    for (size_t i = 0; i < text.size();) {
+        size_t end = i + 1;
+        while (end < text.size() && (static_cast<unsigned char>(text[end]) & 0xC0) == 0x80) end++;
+        chars.push_back(text.substr(i, end - i));
+        i = end;
+    }
+    return chars;
+}
+
+std::string random_word(std::mt19937& rng, const std::vector<std::string>& alphabet, size_t min_length,
+                        size_t max_length) {
+    std::uniform_int_distribution<size_t> length(min_length, max_length);
+    std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+    std::string word;
+    for (size_t n = length(rng); n > 0; n--) {
+        word += alphabet[pick(rng)];
+    }
+    return word;
+}
+
+const std::vector<std::string> WORD_LETTERS = split_code_points("abcdefghijklmnop");
+const std::vector<std::string> FILLER_LETTERS = split_code_points("qrstuvwxyz");
+
+std::vector<std::string> synthetic_words(size_t count) {
+    std::mt19937 rng(42);
+    std::vector<std::string> words;
+    std::unordered_set<std::string> seen;
+    while (words.size() < count) {
+        std::string word = random_word(rng, WORD_LETTERS, 4, 10);
+        if (seen.insert(word).second) words.push_back(word);
+    }
+    return words;
+}
+
+// A message of about length bytes where density percent of the bytes are
+// dictionary words and the rest filler words, separated by spaces.
+std::string make_message(const std::vector<std::string>& words, const std::vector<std::string>& filler,
+                         size_t length, int density) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<size_t> pick(0, words.size() - 1);
+    std::string message;
+    size_t planted = 0;
+    while (message.size() < length) {
+        std::string word;
+        if (planted * 100 < static_cast<size_t>(density) * (message.size() + 1)) {
+            word = words[pick(rng)];
+            planted += word.size();
+        } else {
+            word = random_word(rng, filler, 3, 8);
+        }
+        message += word;
+        message += ' ';
+    }
+    message.resize(length);
+    return message;
+}
+
+// Dictionaries are expensive to build, so every size is built once.
+const Forword& synthetic_forword(size_t words) {
+    static std::map<size_t, std::unique_ptr<Forword>> cache;
+    auto& forword = cache[words];
+    if (!forword) {
+        TempFile file("synthetic.txt");
+        write_words(file, synthetic_words(words));
+        forword = std::make_unique<Forword>(file.path());
+    }
+    return *forword;
+}
+
+const std::string& synthetic_message(size_t words, size_t length, int density) {
+    static std::map<std::tuple<size_t, size_t, int>, std::string> cache;
+    auto& message = cache[{words, length, density}];
+    if (message.empty()) {
+        message = make_message(synthetic_words(std::min<size_t>(words, 1000)), FILLER_LETTERS, length, density);
+    }
+    return message;
+}
+
+void SyntheticArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"words", "bytes", "density"});
+    b->ArgsProduct({{10, 1000, 100000}, {10, 1000, 100000, 1 << 20}, {0, 10, 50}});
+}
+
+void BM_Search(benchmark::State& state) {
+    const Forword& forword = synthetic_forword(state.range(0));
+    const std::string& message = synthetic_message(state.range(0), state.range(1), static_cast<int>(state.range(2)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(forword.search(message));
+    }
+    // search() stops at the first hit, so throughput is in messages
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Search)->Apply(SyntheticArgs);
+
+void BM_Replace(benchmark::State& state) {
+    const Forword& forword = synthetic_forword(state.range(0));
+    const std::string& message = synthetic_message(state.range(0), state.range(1), static_cast<int>(state.range(2)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(forword.replace(message));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * message.size());
+}
+BENCHMARK(BM_Replace)->Apply(SyntheticArgs);
+
+// Synthetic dictionaries built with non-default options, built once each.
+const Forword& configured_forword(size_t words, bool prefilter, size_t dense_dfa_budget,
+                                  size_t result_cache_entries = 0) {
+    static std::map<std::tuple<size_t, bool, size_t, size_t>, std::unique_ptr<Forword>> cache;
+    auto& forword = cache[{words, prefilter, dense_dfa_budget, result_cache_entries}];
+    if (!forword) {
+        Forword::Options options;
+        options.prefilter = prefilter;
+        options.dense_dfa_budget = dense_dfa_budget;
+        options.result_cache_entries = result_cache_entries;
+        TempFile file("synthetic.txt");
+        write_words(file, synthetic_words(words));
+        forword = std::make_unique<Forword>(file.path(), Forword::DEFAULT_IGNORED_SYMBOLS, options);
+    }
+    return *forword;
+}
+
+// Clean messages with and without the bigram prefilter.
+void BM_SearchClean(benchmark::State& state) {
+    const Forword& forword = configured_forword(state.range(0), state.range(2) != 0, 0);
+    const std::string& message = synthetic_message(state.range(0), state.range(1), 0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(forword.search(message));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * message.size());
+}
+BENCHMARK(BM_SearchClean)
+    ->ArgNames({"words", "bytes", "prefilter"})
+    ->ArgsProduct({{10, 1000, 100000}, {1000, 100000}, {0, 1}});
+
+// Replace with the sparse automaton or the dense DFA (256 MB budget), with
+// the prefilter off so every code point goes through the automaton.
+void BM_ReplaceDense(benchmark::State& state) {
+    const Forword& forword = configured_forword(state.range(0), false, state.range(2) ? size_t{256} << 20 : 0);
+    const std::string& message = synthetic_message(state.range(0), state.range(1), 10);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(forword.replace(message));
+    }
+    state.counters["dfa_bytes"] = static_cast<double>(forword.memory_usage().dense_dfa);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * message.size());
+}
+BENCHMARK(BM_ReplaceDense)
+    ->ArgNames({"words", "bytes", "dense"})
+    ->ArgsProduct({{10, 1000, 100000}, {100000}, {0, 1}});
+
+// A spam wave: the same few distinct chat lines over and over, replaced
+// with and without a result cache of 4096 entries.
+void BM_ReplaceRepeated(benchmark::State& state) {
+    const Forword& forword = configured_forword(100000, true, 0, state.range(1) ? 4096 : 0);
+    std::vector<std::string> messages;
+    size_t bytes = 0;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        messages.push_back(std::to_string(i) + " " + synthetic_message(100000, 120, 10));
+        bytes += messages.back().size();
+    }
+    const Forword::CacheStats before = forword.cache_stats();
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            benchmark::DoNotOptimize(forword.replace(message));
+        }
+    }
+    const Forword::CacheStats after = forword.cache_stats();
+    const uint64_t lookups = after.hits + after.misses - before.hits - before.misses;
+    state.counters["hit_rate"] = lookups ? static_cast<double>(after.hits - before.hits) / lookups : 0.0;
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+BENCHMARK(BM_ReplaceRepeated)
+    ->ArgNames({"distinct", "cache"})
+    ->ArgsProduct({{16, 1024, 16384}, {0, 1}});
+
+// Construction from the word list, with the size of the result.
+void BM_Build(benchmark::State& state) {
+    TempFile file("build.txt");
+    write_words(file, synthetic_words(state.range(0)));
+    Forword::MemoryUsage usage{};
+    for (auto _ : state) {
+        Forword forword(file.path());
+        usage = forword.memory_usage();
+    }
+    state.counters["states"] = static_cast<double>(usage.states);
+    state.counters["bytes_per_state"] = static_cast<double>(usage.automaton) / usage.states;
+    state.counters["bytes_per_word"] = static_cast<double>(usage.automaton) / state.range(0);
+}
+BENCHMARK(BM_Build)->ArgName("words")->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMillisecond);
+
+// Build time of a 100k word list by Options::build_threads.
+void BM_BuildThreads(benchmark::State& state) {
+    TempFile file("build_threads.txt");
+    write_words(file, synthetic_words(100000));
+    Forword::Options options;
+    options.build_threads = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        Forword forword(file.path(), Forword::DEFAULT_IGNORED_SYMBOLS, options);
+        benchmark::DoNotOptimize(forword.word_count());
+    }
+}
+BENCHMARK(BM_BuildThreads)->ArgName("threads")->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// Building from a UTF-16LE copy of the synthetic word list (with BOM), to
+// compare with BM_Build on the UTF-8 original.
+void BM_BuildUtf16(benchmark::State& state) {
+    std::string utf16 = "\xFF\xFE";
+    for (const auto& word : synthetic_words(state.range(0))) {
+        for (char ch : word + '\n') {  // the synthetic words are ASCII
+            utf16 += ch;
+            utf16 += '\0';
+        }
+    }
+    TempFile file("build_utf16.txt");
+    std::ofstream(file.path(), std::ios::binary) << utf16;
+    for (auto _ : state) {
+        Forword forword(file.path());
+        benchmark::DoNotOptimize(forword.word_count());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * utf16.size());
+}
+BENCHMARK(BM_BuildUtf16)->ArgName("words")->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMillisecond);
+
+// Stems with a fixed set of endings, built with and without
+// Options::minimize; the counters compare the main automaton before and after.
+void BM_BuildMinimized(benchmark::State& state) {
+    const char* endings[] = {"", "ing", "ed", "er", "ers", "est", "ly", "ness"};
+    std::vector<std::string> words;
+    for (const auto& stem : synthetic_words(state.range(0) / 8)) {
+        for (const char* ending : endings) words.push_back(stem + ending);
+    }
+    TempFile file("build_minimized.txt");
+    write_words(file, words);
+    Forword::Options options;
+    options.minimize = state.range(1) != 0;
+    Forword::MemoryUsage usage{};
+    for (auto _ : state) {
+        Forword forword(file.path(), Forword::DEFAULT_IGNORED_SYMBOLS, options);
+        usage = forword.memory_usage();
+    }
+    state.counters["states"] = static_cast<double>(usage.states);
+    state.counters["trie_states"] = static_cast<double>(usage.trie_states);
+    state.counters["bytes"] = static_cast<double>(usage.automaton);
+    state.counters["trie_bytes"] = static_cast<double>(usage.trie_automaton);
+}
+BENCHMARK(BM_BuildMinimized)
+    ->ArgNames({"words", "minimize"})
+    ->ArgsProduct({{1000, 100000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+
+void BM_LoadCompiled(benchmark::State& state) {
+    TempFile file("compiled.fwd");
+    synthetic_forword(state.range(0)).save_compiled(file.path());
+    for (auto _ : state) {
+        Forword forword(file.path());
+        benchmark::DoNotOptimize(forword.word_count());
+    }
+}
+BENCHMARK(BM_LoadCompiled)->ArgName("words")->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+// Each sample_data dictionary against 4 KiB messages in its own script:
+// filler is drawn from the dictionary's characters that start no word.
+void register_language_benchmarks() {
+    namespace fs = std::filesystem;
+    std::vector<fs::path> files;
+    if (fs::is_directory(FORWORD_SAMPLE_DATA_DIR)) {
+        for (const auto& entry : fs::directory_iterator(FORWORD_SAMPLE_DATA_DIR)) {
+            if (entry.path().extension() == ".txt") files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    for (const auto& file : files) {
+        std::vector<std::string> words;
+        std::ifstream in(file);
+        for (std::string line; std::getline(in, line);) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (!line.empty()) words.push_back(line);
+        }
+        if (words.empty()) continue;
+
+        std::set<std::string> first, all;
+        for (const auto& word : words) {
+            auto chars = split_code_points(word);
+            first.insert(chars.front());
+            all.insert(chars.begin(), chars.end());
+        }
+        std::vector<std::string> filler;
+        for (const auto& ch : all) {
+            if (!first.count(ch) && ch != " ") filler.push_back(ch);
+        }
+        if (filler.empty()) filler = split_code_points("0123456789");
+
+        auto forword = std::make_shared<Forword>(file.string());
+        auto message = std::make_shared<std::string>(make_message(words, filler, 4096, 10));
+        const std::string lang = file.stem().string();
+        benchmark::RegisterBenchmark(("BM_LanguageSearch/" + lang).c_str(), [=](benchmark::State& state) {
+            for (auto _ : state) benchmark::DoNotOptimize(forword->search(*message));
+            state.SetItemsProcessed(state.iterations());
+        });
+        benchmark::RegisterBenchmark(("BM_LanguageReplace/" + lang).c_str(), [=](benchmark::State& state) {
+            for (auto _ : state) benchmark::DoNotOptimize(forword->replace(*message));
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * message->size());
+        });
+    }
+}
+
+}  // namespace
 
+int main(int argc, char** argv) {
+    register_language_benchmarks();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
     return 0;
-} 
\ No newline at end of file
+}
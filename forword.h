@@ -1,292 +1,2604 @@
 #ifndef FORWORD_H
 #define FORWORD_H
 
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <unordered_map>
-#include <queue>
 #include <memory>
 #include <fstream>
 #include <algorithm>
 #include <stdexcept>
 #include <regex>
-#include <locale>
-#include <codecvt>
-#include <set>
+#include <string_view>
+#include <type_traits>
 #include <map>
 #include <iostream>
 #include <unordered_set>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+#include "forword_fold_table.h"
+
+// SIMD front end for the scan loop. SSE2 is part of the x86-64 baseline;
+// AVX2 is compiled per function and selected at run time. Define
+// FORWORD_DISABLE_SIMD to build the scalar path only.
+#if !defined(FORWORD_DISABLE_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FORWORD_HAVE_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define FORWORD_HAVE_AVX2 1
+#define FORWORD_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Opt-in hot-path statistics, see Forword::stats(). Define
+// FORWORD_ENABLE_STATS in all translation units that include this header or
+// in none; without it the counters are compiled out.
+#if defined(FORWORD_ENABLE_STATS)
+#define FORWORD_STATS(...) __VA_ARGS__
+#else
+#define FORWORD_STATS(...)
+#endif
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 class Forword {
 friend class NormalizeUtf8Test;
+friend class SimdScanTest;
+public:
+    // Timed operations in stats(). Normalization, the automaton walk and
+    // match resolution run fused in one pass, so they are timed together.
+    enum class Phase {
+        Scan,     // search(), find_all(), batch searches and Scanner::feed()
+        Replace,  // replace() and replace_batch(), per message
+        Build,    // construction, add_word()/remove_word() and compact()
+    };
+    static constexpr size_t PHASE_COUNT = 3;
+
+    // Snapshot of the counters collected with FORWORD_ENABLE_STATS.
+    struct Stats {
+        // Calls per duration bucket: bucket b counts calls that took
+        // [2^b, 2^(b+1)) nanoseconds.
+        struct Histogram {
+            static constexpr size_t BUCKETS = 40;
+            uint64_t calls{0};
+            uint64_t total_ns{0};
+            std::array<uint64_t, BUCKETS> buckets{};
+        };
+
+        bool enabled{false};
+        uint64_t bytes_scanned{0};
+        uint64_t ignored_code_points{0};  // skipped as ignored symbols
+        uint64_t fail_transitions{0};     // failure links followed by the automaton
+        uint64_t matches{0};
+        std::vector<uint64_t> matches_by_pattern;  // indexed by pattern ID
+        std::array<Histogram, PHASE_COUNT> phases{};
+
+        const Histogram& phase(Phase p) const { return phases[static_cast<size_t>(p)]; }
+    };
+
+    // Counters of the result cache (see Options::result_cache_entries),
+    // since construction.
+    struct CacheStats {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        uint64_t evictions{0};
+        size_t entries{0};   // slots in use, including ones invalidated since
+        size_t capacity{0};
+
+        double hit_rate() const {
+            return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+    };
+
+    // Set of code points skipped while scanning text. ASCII membership is a
+    // single bit test in a 128-bit bitmap; other code points are looked up
+    // in a sorted table of disjoint inclusive ranges. Text is folded before
+    // the test, so an ASCII symbol also covers its full-width form.
+    class IgnoredSymbols {
+    public:
+        IgnoredSymbols() = default;
+
+        IgnoredSymbols(std::initializer_list<char32_t> symbols) {
+            for (char32_t ch : symbols) insert(ch);
+        }
+
+        explicit IgnoredSymbols(std::u32string_view symbols) {
+            for (char32_t ch : symbols) insert(ch);
+        }
+
+        // Every code point of a UTF-8 string, e.g. u8"-_、。".
+        explicit IgnoredSymbols(std::string_view utf8) {
+            for (size_t i = 0; i < utf8.size();) insert(decode_utf8(utf8, i));
+        }
+
+        // Byte sets from earlier versions; only ASCII bytes are meaningful
+        // on their own, so the rest are skipped.
+        IgnoredSymbols(const std::unordered_set<char>& symbols) {
+            for (char symbol : symbols) {
+                auto c = static_cast<unsigned char>(symbol);
+                if (c < 0x80) insert(c);
+            }
+        }
+
+        IgnoredSymbols& insert(char32_t ch) { return insert(ch, ch); }
+
+        // Adds the inclusive range [first, last].
+        IgnoredSymbols& insert(char32_t first, char32_t last) {
+            for (; first <= last && first < 0x80; first++) {
+                ascii_[first >> 6] |= uint64_t{1} << (first & 63);
+            }
+            if (first > last) return *this;
+
+            auto it = std::upper_bound(ranges_.begin(), ranges_.end(), first,
+                                       [](char32_t ch, const Range& r) { return ch < r.first; });
+            if (it != ranges_.begin() && std::prev(it)->last + 1 >= first) {
+                --it;
+                it->last = std::max(it->last, last);
+            } else {
+                it = ranges_.insert(it, Range{first, last});
+            }
+            // Absorb following ranges that now overlap or touch
+            auto next = std::next(it);
+            while (next != ranges_.end() && next->first <= it->last + 1) {
+                it->last = std::max(it->last, next->last);
+                next = ranges_.erase(next);
+            }
+            return *this;
+        }
+
+        bool contains(char32_t ch) const {
+            if (ch < 0x80) return (ascii_[ch >> 6] >> (ch & 63)) & 1;
+            auto it = std::upper_bound(ranges_.begin(), ranges_.end(), ch,
+                                       [](char32_t c, const Range& r) { return c < r.first; });
+            return it != ranges_.begin() && ch <= std::prev(it)->last;
+        }
+
+        const uint64_t* ascii_bitmap() const { return ascii_; }
+
+    private:
+        struct Range {
+            char32_t first;
+            char32_t last;
+        };
+
+        uint64_t ascii_[2]{0, 0};
+        std::vector<Range> ranges_;
+    };
+
+    // ASCII punctuation, CJK punctuation and zero-width characters.
+    static const IgnoredSymbols DEFAULT_IGNORED_SYMBOLS;
+
+    class ThreadPool;
+    class ScanState;
+
+    // Dictionaries with fewer words are always built on the calling thread.
+    static constexpr size_t PARALLEL_BUILD_MIN_WORDS = 16 * 1024;
+
+    // Longer messages bypass the result cache.
+    static constexpr size_t RESULT_CACHE_MAX_TEXT = 1024;
+
+    struct Options {
+        // Run the automata only near bigrams that some dictionary word
+        // starts with, so clean text is rejected by a bitset lookup per
+        // code point. Ignored when the dictionary has single-character
+        // words or too many distinct leading bigrams for the filter to help.
+        bool prefilter{true};
+
+        // Precompute the main automaton's transitions for every state and
+        // character class when the table fits in this many bytes, so each
+        // code point costs one lookup with no failure links to follow.
+        // 0 keeps the sparse automaton only.
+        size_t dense_dfa_budget{0};
+
+        // Threads for normalizing and building dictionaries of at least
+        // PARALLEL_BUILD_MIN_WORDS words; 0 uses every core, 1 builds on
+        // the calling thread only.
+        size_t build_threads{0};
+
+        // Merge main automaton states that behave the same (shared word
+        // endings, DAWG style), so dictionaries with common suffixes take
+        // fewer states. Merged states record match lengths only; the word
+        // behind a match is then found by hashing the matched code points.
+        // A compiled dictionary keeps the form it was saved in.
+        bool minimize{false};
+
+        // Remember the results of search() and replace() for up to this
+        // many distinct messages of at most RESULT_CACHE_MAX_TEXT bytes, so
+        // repeated messages (spam, emotes, bot lines) cost a hash lookup.
+        // Evicts with CLOCK and forgets everything when the dictionary
+        // changes. 0 disables the cache.
+        size_t result_cache_entries{0};
+    };
+
 private:
-    struct TrieNode {
-        std::unordered_map<char32_t, std::unique_ptr<TrieNode>> children;
-        TrieNode* fail{nullptr};
-        std::vector<std::u32string> output;
-        bool is_root{false};
+    // Construction-time trie. Only used while building; the finished trie is
+    // frozen into an Automaton. Nodes live in one monotonic array addressed
+    // by index, with each node's children chained as a sibling list. A build
+    // therefore makes a few large allocations instead of one node and one
+    // hash table per character, and dropping the trie is a single free.
+    struct TrieArena {
+        static constexpr uint32_t NONE = UINT32_MAX;
+
+        struct Node {
+            char32_t label;
+            uint32_t first_child;
+            uint32_t last_child;
+            uint32_t next_sibling;
+            uint32_t pattern_id;
+        };
+
+        std::vector<Node> nodes;
+
+        uint32_t append_child(uint32_t parent, char32_t label) {
+            uint32_t node = static_cast<uint32_t>(nodes.size());
+            nodes.push_back(Node{label, NONE, NONE, NONE, UINT32_MAX});
+            if (nodes[parent].last_child == NONE) {
+                nodes[parent].first_child = node;
+            } else {
+                nodes[nodes[parent].last_child].next_sibling = node;
+            }
+            nodes[parent].last_child = node;
+            return node;
+        }
+    };
+
+    // Read-only view of one automaton array. The array lives either in
+    // Automaton::Arrays (built in memory) or in a mapped compiled dictionary.
+    template <typename T>
+    struct Table {
+        const T* data{nullptr};
+        size_t count{0};
+
+        const T& operator[](size_t i) const { return data[i]; }
+        size_t size() const { return count; }
+        const T* begin() const { return data; }
+        const T* end() const { return data + count; }
+    };
+
+    // Frozen Aho-Corasick automaton.
+    // States are numbered in BFS order (root is 0) and the outgoing edges of
+    // each state are stored contiguously with sorted labels (CSR layout), so
+    // a goto lookup is a binary search over a small slice of one array.
+    // Matches are reported as pattern IDs: output[s] is the pattern ending
+    // exactly at s, and dict_link[s] is the nearest state on the failure
+    // chain that has an output, so every hit costs one step of that chain.
+    // In a minimized automaton (see minimize_automaton()) output[s] is the
+    // length of that pattern instead, and its ID is looked up in word_hash.
+    // The arrays are plain offsets into each other, so the same layout is
+    // written to and mapped back from a compiled dictionary file.
+    struct Automaton {
+        static constexpr uint32_t ROOT = 0;
+        static constexpr uint32_t NO_STATE = UINT32_MAX;
+        static constexpr uint32_t NO_PATTERN = UINT32_MAX;
+
+        // Owned storage of an automaton built in memory.
+        struct Arrays {
+            std::vector<uint32_t> edge_begin;
+            std::vector<char32_t> edge_label;
+            std::vector<uint32_t> edge_target;
+            std::vector<uint32_t> fail;
+            std::vector<uint32_t> output;
+            std::vector<uint32_t> dict_link;
+            std::vector<uint32_t> pattern_length;
+            std::vector<uint32_t> word_offset;
+            std::vector<char> word_text;
+            std::vector<uint64_t> word_hash;
+            std::vector<uint32_t> word_hash_id;
+        };
+
+        Table<uint32_t> edge_begin;   // edges of state s: [edge_begin[s], edge_begin[s + 1])
+        Table<char32_t> edge_label;
+        Table<uint32_t> edge_target;
+        Table<uint32_t> fail;
+        Table<uint32_t> output;
+        Table<uint32_t> dict_link;
+        Table<uint32_t> pattern_length;  // in normalized code points, indexed by pattern ID
+        Table<uint32_t> word_offset;     // dictionary line of pattern p: [word_offset[p], word_offset[p + 1])
+        Table<char> word_text;
+        Table<uint64_t> word_hash;       // sorted hashes of the normalized words; empty unless minimized
+        Table<uint32_t> word_hash_id;    // pattern ID of word_hash[i]
+        size_t max_pattern_length{0};
+        size_t window_size{1};                 // power of two >= max_pattern_length
+        size_t trie_states{0};                 // states and table bytes before minimization
+        size_t trie_bytes{0};
+        std::shared_ptr<const void> storage;   // Arrays or the mapped file behind the tables
+        bool mapped{false};
+
+        // Calls f(table) for every table, in file order.
+        template <typename A, typename F>
+        static void for_each_table(A& a, F&& f) {
+            f(a.edge_begin);
+            f(a.edge_label);
+            f(a.edge_target);
+            f(a.fail);
+            f(a.output);
+            f(a.dict_link);
+            f(a.pattern_length);
+            f(a.word_offset);
+            f(a.word_text);
+            f(a.word_hash);
+            f(a.word_hash_id);
+        }
+
+        void attach(std::shared_ptr<const Arrays> arrays) {
+            auto view = [](const auto& v) { return Table<typename std::decay_t<decltype(v)>::value_type>{v.data(), v.size()}; };
+            edge_begin = view(arrays->edge_begin);
+            edge_label = view(arrays->edge_label);
+            edge_target = view(arrays->edge_target);
+            fail = view(arrays->fail);
+            output = view(arrays->output);
+            dict_link = view(arrays->dict_link);
+            pattern_length = view(arrays->pattern_length);
+            word_offset = view(arrays->word_offset);
+            word_text = view(arrays->word_text);
+            word_hash = view(arrays->word_hash);
+            word_hash_id = view(arrays->word_hash_id);
+            storage = std::move(arrays);
+        }
+
+        size_t state_count() const { return fail.size(); }
+        bool minimized() const { return word_hash.size() > 0; }
+
+        size_t table_bytes() const {
+            size_t bytes = 0;
+            for_each_table(*this, [&](const auto& table) { bytes += table.size() * sizeof(*table.data); });
+            return bytes;
+        }
+        size_t pattern_count() const { return pattern_length.size(); }
+
+        std::string_view word(uint32_t pattern_id) const {
+            return std::string_view(word_text.data + word_offset[pattern_id],
+                                    word_offset[pattern_id + 1] - word_offset[pattern_id]);
+        }
+
+        uint32_t child(uint32_t state, char32_t ch) const {
+            auto first = edge_label.begin() + edge_begin[state];
+            auto last = edge_label.begin() + edge_begin[state + 1];
+            auto it = std::lower_bound(first, last, ch);
+            if (it == last || *it != ch) return NO_STATE;
+            return edge_target[it - edge_label.begin()];
+        }
+
+        // Goto with failure transitions; never fails (falls back to root).
+        uint32_t next(uint32_t state, char32_t ch) const {
+            while (true) {
+                uint32_t target = child(state, ch);
+                if (target != NO_STATE) return target;
+                if (state == ROOT) return ROOT;
+                state = fail[state];
+            }
+        }
+
+        // next() that also counts the failure links it follows.
+        uint32_t next(uint32_t state, char32_t ch, uint64_t& failures) const {
+            while (true) {
+                uint32_t target = child(state, ch);
+                if (target != NO_STATE) return target;
+                if (state == ROOT) return ROOT;
+                state = fail[state];
+                failures++;
+            }
+        }
+
+        bool has_output(uint32_t state) const {
+            return output[state] != NO_PATTERN || dict_link[state] != NO_STATE;
+        }
+
+        // Call f(pattern_id, length) for every pattern ending at state, longest
+        // first. A minimized automaton passes NO_PATTERN; see find_word().
+        template <typename F>
+        void for_each_output(uint32_t state, F&& f) const {
+            if (output[state] == NO_PATTERN) state = dict_link[state];
+            const bool lengths = minimized();
+            for (; state != NO_STATE; state = dict_link[state]) {
+                if (lengths) {
+                    f(NO_PATTERN, output[state]);
+                } else {
+                    f(output[state], pattern_length[output[state]]);
+                }
+            }
+        }
+
+        // FNV-1a over code points; feed a normalized word to hash_step() one
+        // code point at a time, starting from HASH_SEED.
+        static constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ull;
+        static uint64_t hash_step(uint64_t hash, char32_t ch) {
+            return (hash ^ ch) * 0x100000001b3ull;
+        }
+
+        // Pattern ID of the word with the given hash in a minimized
+        // automaton, or NO_PATTERN.
+        uint32_t find_word(uint64_t hash) const {
+            auto it = std::lower_bound(word_hash.begin(), word_hash.end(), hash);
+            if (it == word_hash.end() || *it != hash) return NO_PATTERN;
+            return word_hash_id[it - word_hash.begin()];
+        }
+    };
+
+    // Compiled dictionary file (see save_compiled()): this header, then the
+    // automaton tables in for_each_table() order, each at an 8-byte aligned
+    // offset. Integers are in the byte order of the compiling machine.
+    // A file that loads has the expected magic, version, byte order and
+    // folding table, every table inside the file with consistent sizes, and
+    // every index inside the table it points into (see
+    // invalid_table_entry()), so scanning it cannot read out of bounds or
+    // loop. There is no checksum: a damaged file that still passes these
+    // checks loads and matches the wrong words.
+    static constexpr char COMPILED_MAGIC[8] = {'F', 'O', 'R', 'W', 'O', 'R', 'D', '\0'};
+    static constexpr uint32_t COMPILED_VERSION = 2;
+    static constexpr uint32_t COMPILED_BYTE_ORDER = 0x01020304;
+    static constexpr size_t COMPILED_TABLES = 11;
+
+    struct CompiledHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        char unicode_version[16];        // of the folding table the words were normalized with
+        uint64_t max_pattern_length;
+        uint64_t window_size;
+        uint64_t trie_states;            // before minimization
+        uint64_t trie_bytes;
+        uint64_t tables[COMPILED_TABLES][2];  // byte offset and element count
+    };
+
+    // Flushes a written file to disk before it is renamed into place.
+    static bool sync_file(const std::string& path) {
+#if !defined(_WIN32)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        bool synced = ::fsync(fd) == 0;
+        ::close(fd);
+        return synced;
+#else
+        return true;
+#endif
+    }
+
+    // A file mapped read-only, so every process loading the same compiled
+    // dictionary shares its pages. Without mmap the file is read into memory.
+    // The mapping is shared with the file, so a compiled dictionary must be
+    // replaced by rename() (as save_compiled() does), never rewritten in
+    // place: a reader touching a page cut off by truncation gets SIGBUS.
+    // Word lists are only parsed once, so they are read into memory with
+    // Access::Read and an editor saving over one cannot crash a reload.
+    class MappedFile {
+    public:
+        enum class Access { Map, Read };
+
+        explicit MappedFile(const std::string& path, const std::string& what = "compiled dictionary",
+                            Access access = Access::Map) {
+#if !defined(_WIN32)
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("Failed to open " + what + ": " + path);
+            }
+            struct stat st;
+            if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+                size_ = static_cast<size_t>(st.st_size);
+                if (access == Access::Map) {
+                    void* p = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+                    data_ = p == MAP_FAILED ? nullptr : static_cast<const char*>(p);
+                } else if (!read_all(fd)) {
+                    size_ = 0;
+                    ::close(fd);
+                    throw std::runtime_error("Failed to read " + what + ": " + path);
+                }
+            }
+            ::close(fd);
+            if (size_ > 0 && data_ == nullptr) {
+                throw std::runtime_error("Failed to map " + what + ": " + path);
+            }
+#else
+            (void)access;
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                throw std::runtime_error("Failed to open " + what + ": " + path);
+            }
+            size_ = static_cast<size_t>(file.tellg());
+            copy_.resize((size_ + 7) / 8);
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(copy_.data()), size_);
+            data_ = reinterpret_cast<const char*>(copy_.data());
+#endif
+        }
+
+        ~MappedFile() {
+#if !defined(_WIN32)
+            if (data_ != nullptr && copy_.empty()) {
+                ::munmap(const_cast<char*>(data_), size_);
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const char* data() const { return data_; }
+        size_t size() const { return size_; }
+
+    private:
+#if !defined(_WIN32)
+        // Reads until end of file, which may have moved since fstat()
+        bool read_all(int fd) {
+            size_t length = 0;
+            copy_.resize(size_ / 8 + 1);
+            for (;;) {
+                if (length == copy_.size() * 8) copy_.resize(copy_.size() * 2);
+                ssize_t n = ::read(fd, reinterpret_cast<char*>(copy_.data()) + length, copy_.size() * 8 - length);
+                if (n < 0 && errno == EINTR) continue;
+                if (n < 0) return false;
+                if (n == 0) break;
+                length += static_cast<size_t>(n);
+            }
+            size_ = length;
+            data_ = reinterpret_cast<const char*>(copy_.data());
+            return true;
+        }
+#endif
+
+        const char* data_{nullptr};
+        size_t size_{0};
+        std::vector<uint64_t> copy_;  // 8-byte aligned like a mapping
+    };
+
+    // Small per-thread number for spreading contended counters over slots.
+    static size_t thread_slot() {
+        thread_local const size_t slot = std::hash<std::thread::id>()(std::this_thread::get_id());
+        return slot;
+    }
+
+    // Counters behind stats(). Each thread adds to one of a few cache-line
+    // sized shards with relaxed atomics, once per call rather than per
+    // character, so recording stays off the critical path and stats() can
+    // sum the shards from any thread. Matches are counted per match, so the
+    // per-pattern counts are sharded as well: one row of SHARDS per pattern
+    // ID, 8 * SHARDS bytes per word. A copy starts from zero.
+    class StatsRegistry {
+    public:
+        StatsRegistry() : shards_(new Shard[SHARDS]) {}
+
+        StatsRegistry(const StatsRegistry& other) : StatsRegistry() {
+            resize_patterns(other.pattern_count_);
+        }
+
+        StatsRegistry& operator=(const StatsRegistry& other) {
+            if (this != &other) {
+                shards_.reset(new Shard[SHARDS]);
+                pattern_matches_.reset();
+                pattern_count_ = 0;
+                resize_patterns(other.pattern_count_);
+            }
+            return *this;
+        }
+
+        void add_scan(uint64_t bytes, uint64_t ignored) {
+            Shard& s = shard();
+            s.bytes.fetch_add(bytes, std::memory_order_relaxed);
+            s.ignored.fetch_add(ignored, std::memory_order_relaxed);
+        }
+
+        void add_failures(uint64_t failures) {
+            shard().failures.fetch_add(failures, std::memory_order_relaxed);
+        }
+
+        void add_match(uint32_t pattern_id) {
+            shard().matches.fetch_add(1, std::memory_order_relaxed);
+            if (pattern_id < pattern_count_) {
+                pattern_matches_[slot() * pattern_count_ + pattern_id].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void add_time(Phase phase, uint64_t ns) {
+            size_t bucket = 0;
+            while (bucket + 1 < Stats::Histogram::BUCKETS && (ns >> (bucket + 1)) != 0) {
+                bucket++;
+            }
+            auto& h = shard().phases[static_cast<size_t>(phase)];
+            h.calls.fetch_add(1, std::memory_order_relaxed);
+            h.total_ns.fetch_add(ns, std::memory_order_relaxed);
+            h.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Keeps the counts of existing pattern IDs. Not safe during scans.
+        void resize_patterns(size_t count) {
+            std::unique_ptr<std::atomic<uint64_t>[]> resized(new std::atomic<uint64_t>[SHARDS * count]);
+            for (size_t shard = 0; shard < SHARDS; shard++) {
+                for (size_t i = 0; i < count; i++) {
+                    resized[shard * count + i].store(
+                        i < pattern_count_ ? pattern_matches_[shard * pattern_count_ + i].load() : 0);
+                }
+            }
+            pattern_matches_ = std::move(resized);
+            pattern_count_ = count;
+        }
+
+        Stats snapshot() const {
+            Stats stats;
+            stats.enabled = true;
+            for (size_t i = 0; i < SHARDS; i++) {
+                const Shard& s = shards_[i];
+                stats.bytes_scanned += s.bytes.load(std::memory_order_relaxed);
+                stats.ignored_code_points += s.ignored.load(std::memory_order_relaxed);
+                stats.fail_transitions += s.failures.load(std::memory_order_relaxed);
+                stats.matches += s.matches.load(std::memory_order_relaxed);
+                for (size_t p = 0; p < PHASE_COUNT; p++) {
+                    stats.phases[p].calls += s.phases[p].calls.load(std::memory_order_relaxed);
+                    stats.phases[p].total_ns += s.phases[p].total_ns.load(std::memory_order_relaxed);
+                    for (size_t b = 0; b < Stats::Histogram::BUCKETS; b++) {
+                        stats.phases[p].buckets[b] += s.phases[p].buckets[b].load(std::memory_order_relaxed);
+                    }
+                }
+            }
+            stats.matches_by_pattern.assign(pattern_count_, 0);
+            for (size_t i = 0; i < SHARDS * pattern_count_; i++) {
+                stats.matches_by_pattern[i % pattern_count_] += pattern_matches_[i].load(std::memory_order_relaxed);
+            }
+            return stats;
+        }
+
+        void reset() {
+            for (size_t i = 0; i < SHARDS; i++) {
+                Shard& s = shards_[i];
+                for (auto* counter : {&s.bytes, &s.ignored, &s.failures, &s.matches}) {
+                    counter->store(0, std::memory_order_relaxed);
+                }
+                for (auto& phase : s.phases) {
+                    phase.calls.store(0, std::memory_order_relaxed);
+                    phase.total_ns.store(0, std::memory_order_relaxed);
+                    for (auto& bucket : phase.buckets) bucket.store(0, std::memory_order_relaxed);
+                }
+            }
+            for (size_t i = 0; i < SHARDS * pattern_count_; i++) {
+                pattern_matches_[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        static constexpr size_t SHARDS = 16;
+
+        struct PhaseCounters {
+            std::atomic<uint64_t> calls{0};
+            std::atomic<uint64_t> total_ns{0};
+            std::array<std::atomic<uint64_t>, Stats::Histogram::BUCKETS> buckets{};
+        };
+
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> bytes{0};
+            std::atomic<uint64_t> ignored{0};
+            std::atomic<uint64_t> failures{0};
+            std::atomic<uint64_t> matches{0};
+            std::array<PhaseCounters, PHASE_COUNT> phases;
+        };
+
+        static size_t slot() { return thread_slot() % SHARDS; }
+        Shard& shard() { return shards_[slot()]; }
+
+        std::unique_ptr<Shard[]> shards_;
+        std::unique_ptr<std::atomic<uint64_t>[]> pattern_matches_;  // SHARDS rows of pattern_count_
+        size_t pattern_count_{0};
+    };
+
+    // Bytes and ignored code points of one normalization pass, recorded
+    // when it ends (early or not).
+    struct ScanTally {
+        StatsRegistry& stats;
+        const size_t& position;
+        uint64_t ignored{0};
+
+        ~ScanTally() { stats.add_scan(position, ignored); }
+    };
+
+    // Adds the duration of its scope to a phase histogram.
+    class PhaseTimer {
+    public:
+        PhaseTimer(StatsRegistry& stats, Phase phase)
+            : stats_(stats), phase_(phase), start_(std::chrono::steady_clock::now()) {}
+
+        ~PhaseTimer() {
+            auto elapsed = std::chrono::steady_clock::now() - start_;
+            stats_.add_time(phase_, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+    private:
+        StatsRegistry& stats_;
+        Phase phase_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    // Results of search() and replace() by message: a search verdict per
+    // text, a replaced text per text and replacement. Entries are spread
+    // over shards by hash, each with its own lock and a CLOCK hand: a full
+    // shard evicts the first entry not hit since the hand last passed it.
+    // invalidate() retires every entry at once by moving to a new
+    // generation. A copy starts empty with the same capacity.
+    class ResultCache {
+    public:
+        // capacity is rounded up to a multiple of the shard count.
+        explicit ResultCache(size_t capacity = 0) : capacity_((capacity + SHARDS - 1) / SHARDS * SHARDS) {
+            if (capacity_ > 0) {
+                shards_.reset(new Shard[SHARDS]);
+            }
+        }
+
+        ResultCache(const ResultCache& other) : ResultCache(other.capacity_) {}
+
+        ResultCache& operator=(const ResultCache& other) {
+            if (this != &other) {
+                capacity_ = other.capacity_;
+                shards_.reset(capacity_ > 0 ? new Shard[SHARDS] : nullptr);
+                generation_.store(0);
+            }
+            return *this;
+        }
+
+        bool enabled() const { return shards_ != nullptr; }
+
+        bool find_verdict(std::string_view text, bool& found) {
+            return find(Key{text, {}, true}, [&](const Entry& e) { found = e.found; });
+        }
+
+        void store_verdict(std::string_view text, bool found) {
+            store(Key{text, {}, true}, [&](Entry& e) { e.found = found; });
+        }
+
+        bool find_replaced(std::string_view text, std::string_view replacement, std::string& out) {
+            return find(Key{text, replacement, false}, [&](const Entry& e) { out = e.replaced; });
+        }
+
+        void store_replaced(std::string_view text, std::string_view replacement, const std::string& replaced) {
+            store(Key{text, replacement, false}, [&](Entry& e) { e.replaced = replaced; });
+        }
+
+        void invalidate() {
+            generation_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        CacheStats stats() const {
+            CacheStats stats;
+            stats.capacity = capacity_;
+            if (!enabled()) return stats;
+            for (size_t i = 0; i < SHARDS; i++) {
+                Shard& s = shards_[i];
+                std::lock_guard<std::mutex> lock(s.mutex);
+                stats.hits += s.hits;
+                stats.misses += s.misses;
+                stats.evictions += s.evictions;
+                stats.entries += s.entries.size();
+            }
+            return stats;
+        }
+
+    private:
+        static constexpr size_t SHARDS = 16;
+
+        struct Key {
+            std::string_view text;
+            std::string_view replacement;
+            bool search;
+
+            uint64_t hash() const {
+                uint64_t h = std::hash<std::string_view>()(text);
+                if (!search) h ^= (std::hash<std::string_view>()(replacement) + 1) * 0x9E3779B97F4A7C15ull;
+                return h;
+            }
+        };
+
+        struct Entry {
+            uint64_t hash{0};
+            uint64_t generation{0};
+            std::string text;
+            std::string replacement;
+            bool search{false};
+            bool referenced{false};
+            bool found{false};
+            std::string replaced;
+
+            bool matches(const Key& key) const {
+                return search == key.search && text == key.text && replacement == key.replacement;
+            }
+        };
+
+        struct alignas(64) Shard {
+            std::mutex mutex;
+            std::vector<Entry> entries;
+            std::unordered_map<uint64_t, uint32_t> index;  // hash -> entries slot
+            size_t hand{0};
+            uint64_t hits{0};
+            uint64_t misses{0};
+            uint64_t evictions{0};
+        };
+
+        Shard& shard(uint64_t hash) const { return shards_[(hash >> 32) % SHARDS]; }
+
+        // The live entry for key, or nullptr. Call with the shard locked.
+        Entry* lookup(Shard& s, const Key& key, uint64_t hash) const {
+            auto it = s.index.find(hash);
+            if (it == s.index.end()) return nullptr;
+            Entry& e = s.entries[it->second];
+            if (e.generation != generation_.load(std::memory_order_relaxed) || !e.matches(key)) return nullptr;
+            return &e;
+        }
+
+        // Calls read(entry) on the live entry for key, if there is one.
+        template <typename F>
+        bool find(const Key& key, F&& read) {
+            const uint64_t hash = key.hash();
+            Shard& s = shard(hash);
+            std::lock_guard<std::mutex> lock(s.mutex);
+            Entry* e = lookup(s, key, hash);
+            if (e == nullptr) {
+                s.misses++;
+                return false;
+            }
+            read(*e);
+            e->referenced = true;
+            s.hits++;
+            return true;
+        }
+
+        // Calls write(entry) on the entry for key, claiming one first: the
+        // slot of a stale entry with the same hash, a free slot, or the
+        // CLOCK victim.
+        template <typename F>
+        void store(const Key& key, F&& write) {
+            const uint64_t hash = key.hash();
+            Shard& s = shard(hash);
+            std::lock_guard<std::mutex> lock(s.mutex);
+            Entry* e = lookup(s, key, hash);
+            if (e == nullptr) {
+                auto it = s.index.find(hash);
+                uint32_t slot;
+                if (it != s.index.end()) {
+                    slot = it->second;
+                } else if (s.entries.size() < capacity_ / SHARDS) {
+                    slot = static_cast<uint32_t>(s.entries.size());
+                    s.entries.emplace_back();
+                    s.index.emplace(hash, slot);
+                } else {
+                    while (s.entries[s.hand].referenced) {
+                        s.entries[s.hand].referenced = false;
+                        s.hand = (s.hand + 1) % s.entries.size();
+                    }
+                    slot = static_cast<uint32_t>(s.hand);
+                    s.hand = (s.hand + 1) % s.entries.size();
+                    // Move the victim's index node over instead of allocating one
+                    auto node = s.index.extract(s.entries[slot].hash);
+                    node.key() = hash;
+                    s.index.insert(std::move(node));
+                    s.evictions++;
+                }
+                e = &s.entries[slot];
+                e->hash = hash;
+                e->generation = generation_.load(std::memory_order_relaxed);
+                e->text.assign(key.text);
+                e->replacement.assign(key.replacement);
+                e->search = key.search;
+                e->referenced = false;
+            }
+            write(*e);
+        }
+
+        size_t capacity_;
+        std::unique_ptr<Shard[]> shards_;
+        std::atomic<uint64_t> generation_{0};
+    };
+
+    // Bitset of the first two normalized code points of every dictionary
+    // word, hashed. A word can only start where the text has one of these
+    // bigrams; empty when the filter is off. Like the automaton tables, the
+    // bits are immutable once built and shared by copies of the dictionary.
+    struct Prefilter {
+        static constexpr uint32_t MIN_BITS_LOG2 = 12;
+        static constexpr uint32_t MAX_BITS_LOG2 = 20;
+
+        Table<uint64_t> bits;
+        uint32_t shift{32};
+        std::shared_ptr<const std::vector<uint64_t>> storage;
+
+        void attach(std::shared_ptr<const std::vector<uint64_t>> words) {
+            bits = Table<uint64_t>{words->data(), words->size()};
+            storage = std::move(words);
+        }
+
+        bool enabled() const { return bits.size() > 0; }
+
+        uint32_t slot(char32_t a, char32_t b) const {
+            return ((a * 0x9E3779B1u) ^ (b * 0x85EBCA77u)) >> shift;
+        }
+
+        bool test(char32_t a, char32_t b) const {
+            uint32_t k = slot(a, b);
+            return (bits[k >> 6] >> (k & 63)) & 1;
+        }
+
+        size_t bytes() const { return bits.size() * sizeof(uint64_t); }
+    };
+
+    // The main automaton's goto function with failure links resolved, over
+    // character classes: one class per code point on a dictionary edge and
+    // class 0 for all others. States keep the automaton's numbering, so its
+    // output tables still apply. Empty when off. The tables are views of
+    // shared storage, as in Automaton, so copying a dictionary (e.g. in
+    // Reloadable::update()) does not copy them.
+    struct DenseDfa {
+        static constexpr uint32_t PAGE_BITS = 8;
+        static constexpr uint32_t PAGE_SIZE = 1u << PAGE_BITS;
+        static constexpr uint32_t BMP_PAGES = 0x10000 >> PAGE_BITS;
+
+        struct Arrays {
+            std::vector<uint32_t> page_index;
+            std::vector<uint32_t> pages;
+            std::vector<char32_t> astral;
+            std::vector<uint32_t> table;
+        };
+
+        // Classes of the BMP in pages of PAGE_SIZE code points; pages
+        // without dictionary code points share the all-zero page 0.
+        Table<uint32_t> page_index;
+        Table<uint32_t> pages;
+        // Dictionary code points above the BMP, sorted; the class of
+        // astral[k] is bmp_classes + k.
+        Table<char32_t> astral;
+        uint32_t bmp_classes{0};
+        uint32_t classes{0};
+        Table<uint32_t> table;  // [state * classes + class] -> state
+        std::shared_ptr<const Arrays> storage;
+
+        void attach(std::shared_ptr<const Arrays> arrays) {
+            page_index = Table<uint32_t>{arrays->page_index.data(), arrays->page_index.size()};
+            pages = Table<uint32_t>{arrays->pages.data(), arrays->pages.size()};
+            astral = Table<char32_t>{arrays->astral.data(), arrays->astral.size()};
+            table = Table<uint32_t>{arrays->table.data(), arrays->table.size()};
+            storage = std::move(arrays);
+        }
+
+        bool enabled() const { return table.size() > 0; }
+
+        uint32_t classify(char32_t ch) const {
+            if (ch < 0x10000) return pages[(page_index[ch >> PAGE_BITS] << PAGE_BITS) | (ch & (PAGE_SIZE - 1))];
+            auto it = std::lower_bound(astral.begin(), astral.end(), ch);
+            if (it == astral.end() || *it != ch) return 0;
+            return bmp_classes + static_cast<uint32_t>(it - astral.begin());
+        }
+
+        uint32_t next(uint32_t state, char32_t ch) const {
+            return table[static_cast<size_t>(state) * classes + classify(ch)];
+        }
+
+        size_t bytes() const {
+            return (page_index.size() + pages.size() + table.size()) * sizeof(uint32_t) +
+                   astral.size() * sizeof(char32_t);
+        }
+    };
+
+    IgnoredSymbols ignored_symbols_;
+
+    // ASCII part of ignored_symbols_ as a low-nibble -> high-nibble-bits
+    // table for the SIMD shuffle lookup.
+    alignas(16) uint8_t ignored_nibble_table_[16]{};
+
+    enum class SimdLevel { None, SSE2, AVX2 };
+    SimdLevel simd_level_{detect_simd_level()};
+    Options options_;
+    Automaton automaton_;
+
+    // Words added since the last compact() live in the small delta
+    // automaton, scanned alongside the main one; their pattern IDs follow
+    // the main automaton's. Removed main words are only marked in removed_.
+    Automaton delta_;
+    std::vector<std::u32string> delta_words_;
+    std::vector<std::string> delta_originals_;
+    std::vector<bool> removed_;
+    size_t removed_count_{0};
+    size_t max_pattern_length_{0};  // over both automata
+    size_t window_size_{1};         // power of two >= max_pattern_length_
+    Prefilter prefilter_;
+    DenseDfa dense_;
+    FORWORD_STATS(mutable StatsRegistry stats_;)
+    mutable ResultCache cache_;
+    // Changes whenever the words do; copies of an unchanged dictionary share
+    // it. Lets a ScanState tell whether its automaton positions still apply.
+    uint64_t dictionary_id_{next_dictionary_id()};
+
+    static uint64_t next_dictionary_id() {
+        static std::atomic<uint64_t> next{0};
+        return next.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    void dictionary_changed() {
+        cache_.invalidate();
+        dictionary_id_ = next_dictionary_id();
+    }
+
+    // Decode the UTF-8 sequence starting at s[i] and advance i past it.
+    // Malformed or truncated sequences decode as U+FFFD and consume one byte.
+    static char32_t decode_utf8(std::string_view s, size_t& i) {
+        unsigned char lead = static_cast<unsigned char>(s[i]);
+        if (lead < 0x80) {
+            i++;
+            return lead;
+        }
+
+        size_t len;
+        char32_t cp;
+        char32_t min_cp;
+        if ((lead & 0xE0) == 0xC0) { len = 2; cp = lead & 0x1F; min_cp = 0x80; }
+        else if ((lead & 0xF0) == 0xE0) { len = 3; cp = lead & 0x0F; min_cp = 0x800; }
+        else if ((lead & 0xF8) == 0xF0) { len = 4; cp = lead & 0x07; min_cp = 0x10000; }
+        else { i++; return 0xFFFD; }
+
+        if (len > s.size() - i) {
+            i++;
+            return 0xFFFD;
+        }
+        for (size_t k = 1; k < len; k++) {
+            unsigned char cont = static_cast<unsigned char>(s[i + k]);
+            if ((cont & 0xC0) != 0x80) {
+                i++;
+                return 0xFFFD;
+            }
+            cp = (cp << 6) | (cont & 0x3F);
+        }
+        if (cp < min_cp || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            i++;
+            return 0xFFFD;
+        }
+        i += len;
+        return cp;
+    }
+
+    static void append_utf8(std::string& out, char32_t ch) {
+        if (ch < 0x80) {
+            out.push_back(static_cast<char>(ch));
+        } else if (ch < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (ch >> 6)));
+            out.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+        } else if (ch < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (ch >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (ch >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((ch >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+        }
+    }
+
+    // Case, accent and compatibility folding for a single code point via the
+    // generated table in forword_fold_table.h. Writes the folded code points
+    // to out and returns how many were written: 0 drops the character (e.g.
+    // combining marks), more than 1 is an expansion such as ß -> ss.
+    static size_t fold_char(char32_t ch, char32_t out[forword_fold::MAX_EXPANSION]) {
+        if (ch < 0x80) {
+            out[0] = (ch >= U'A' && ch <= U'Z') ? ch - U'A' + U'a' : ch;
+            return 1;
+        }
+
+        const forword_fold::Value& folded = forword_fold::lookup(ch);
+        if (folded.length == 1) {
+            out[0] = static_cast<char32_t>(static_cast<int32_t>(ch) + folded.delta);
+            return 1;
+        }
+        for (uint32_t k = 0; k < folded.length; k++) {
+            out[k] = folded.chars[k];
+        }
+        return folded.length;
+    }
+
+    // Streaming normalizer: decodes UTF-8, folds case and accents and calls
+    // f(ch, begin, end) for every folded code point, where [begin, end) is
+    // the byte range of the original character. Stops early and returns
+    // false as soon as f returns false. Nothing is allocated.
+    template <typename F>
+    static bool for_each_folded(std::string_view text, F&& f) {
+        size_t i = 0;
+        while (i < text.size()) {
+            size_t begin = i;
+            char32_t folded[forword_fold::MAX_EXPANSION];
+            size_t count = fold_char(decode_utf8(text, i), folded);
+            for (size_t k = 0; k < count; k++) {
+                if (!f(folded[k], begin, i)) return false;
+            }
+        }
+        return true;
+    }
+
+    void init_ignored_tables() {
+        for (char32_t c = 0; c < 0x80; c++) {
+            if (ignored_symbols_.contains(c)) {
+                ignored_nibble_table_[c & 0x0F] |= static_cast<uint8_t>(1u << (c >> 4));
+            }
+        }
+    }
+
+    bool is_ignored(char32_t ch) const {
+        return ignored_symbols_.contains(ch);
+    }
+
+    static SimdLevel detect_simd_level() {
+#if defined(FORWORD_HAVE_AVX2)
+        // A static Forword can be built before the CPU model is initialized
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+#endif
+#if defined(FORWORD_HAVE_SSE2)
+        return SimdLevel::SSE2;
+#else
+        return SimdLevel::None;
+#endif
+    }
+
+    static int count_trailing_zeros(uint32_t x) {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, x);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(x);
+#endif
+    }
+
+#if defined(FORWORD_HAVE_AVX2)
+    // Lowercase 32 bytes into lowered. Returns the mask of non-ASCII bytes
+    // and sets keep to the ASCII bytes that are not ignored symbols.
+    FORWORD_TARGET_AVX2
+    static uint32_t scan_block_avx2(const char* p, char* lowered, const uint8_t* nibble_table, uint32_t& keep) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        uint32_t non_ascii = static_cast<uint32_t>(_mm256_movemask_epi8(x));
+
+        // Non-ASCII bytes compare as negative, so they never look like 'A'..'Z'
+        __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8('A' - 1)),
+                                         _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), x));
+        __m256i low = _mm256_add_epi8(x, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(lowered), low);
+
+        // table[lo] has bit hi set when byte (hi << 4 | lo) is ignored
+        __m256i table = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(nibble_table)));
+        __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+                                        1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+        __m256i nibble = _mm256_set1_epi8(0x0F);
+        __m256i lo = _mm256_and_si256(low, nibble);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(low, 4), nibble);
+        __m256i hit = _mm256_and_si256(_mm256_shuffle_epi8(table, lo), _mm256_shuffle_epi8(bits, hi));
+        uint32_t kept = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hit, _mm256_setzero_si256())));
+
+        keep = kept & ~non_ascii;
+        return non_ascii;
+    }
+#endif
+
+#if defined(FORWORD_HAVE_SSE2)
+    // 16-byte variant of scan_block_avx2; SSE2 has no byte shuffle, so the
+    // ignored-symbol test uses the ASCII bitmap.
+    static uint32_t scan_block_sse2(const char* p, char* lowered, const uint64_t* bitmap, uint32_t& keep) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        uint32_t non_ascii = static_cast<uint32_t>(_mm_movemask_epi8(x));
+
+        __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)),
+                                      _mm_cmplt_epi8(x, _mm_set1_epi8('Z' + 1)));
+        __m128i low = _mm_add_epi8(x, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lowered), low);
+
+        uint32_t kept = 0;
+        for (int k = 0; k < 16; k++) {
+            auto c = static_cast<unsigned char>(lowered[k]) & 0x7F;
+            kept |= static_cast<uint32_t>(((bitmap[c >> 6] >> (c & 63)) & 1) ^ 1) << k;
+        }
+
+        keep = kept & ~non_ascii;
+        return non_ascii;
+    }
+#endif
+
+    // Block size of the SIMD front end, 0 when running scalar.
+    size_t simd_block_size() const {
+        switch (simd_level_) {
+            case SimdLevel::AVX2: return 32;
+            case SimdLevel::SSE2: return 16;
+            default: return 0;
+        }
+    }
+
+    uint32_t scan_ascii_block(const char* p, char* lowered, uint32_t& keep) const {
+        switch (simd_level_) {
+#if defined(FORWORD_HAVE_AVX2)
+            case SimdLevel::AVX2: return scan_block_avx2(p, lowered, ignored_nibble_table_, keep);
+#endif
+#if defined(FORWORD_HAVE_SSE2)
+            case SimdLevel::SSE2: return scan_block_sse2(p, lowered, ignored_symbols_.ascii_bitmap(), keep);
+#endif
+            default: keep = 0; return ~0u;
+        }
+    }
+
+    // Same as for_each_folded, with the configured ignored symbols skipped.
+    // Runs of ASCII are lowercased and filtered a SIMD block at a time;
+    // only non-ASCII bytes go through the scalar UTF-8 decoder.
+    template <typename F>
+    bool for_each_normalized(std::string_view text, F&& f) const {
+        const char* data = text.data();
+        const size_t size = text.size();
+        const size_t block = simd_block_size();
+        alignas(32) char lowered[32];
+        size_t i = 0;
+        FORWORD_STATS(ScanTally tally{stats_, i};)
+
+        while (i < size) {
+            if (block != 0 && size - i >= block) {
+                uint32_t keep;
+                uint32_t non_ascii = scan_ascii_block(data + i, lowered, keep);
+                size_t ascii_len = non_ascii ? count_trailing_zeros(non_ascii) : block;
+                if (ascii_len < 32) keep &= (1u << ascii_len) - 1;
+                FORWORD_STATS(tally.ignored += ascii_len - std::bitset<32>(keep).count();)
+                while (keep) {
+                    int k = count_trailing_zeros(keep);
+                    keep &= keep - 1;
+                    if (!f(static_cast<char32_t>(lowered[k]), i + k, i + k + 1)) return false;
+                }
+                i += ascii_len;
+                if (ascii_len == block) continue;
+            }
+
+            // Scalar path: at least one character, then the rest of a non-ASCII run
+            do {
+                size_t begin = i;
+                char32_t folded[forword_fold::MAX_EXPANSION];
+                size_t count = fold_char(decode_utf8(text, i), folded);
+                for (size_t k = 0; k < count; k++) {
+                    if (is_ignored(folded[k])) {
+                        FORWORD_STATS(tally.ignored++;)
+                        continue;
+                    }
+                    if (!f(folded[k], begin, i)) return false;
+                }
+            } while (i < size && static_cast<unsigned char>(data[i]) >= 0x80);
+        }
+        return true;
+    }
+
+    // A match in both coordinate systems: normalized code point positions
+    // [norm_begin, norm_end] and the original byte range [byte_begin, byte_end).
+    struct Span {
+        size_t norm_begin;
+        size_t norm_end;
+        size_t byte_begin;
+        size_t byte_end;
+    };
+
+    // Resolves overlapping matches with leftmost-longest semantics while the
+    // automaton is still walking. Matches are added in order of their end
+    // position; a candidate becomes final once the scan is a full pattern
+    // length past its start, so at most window_size candidates are pending
+    // when commit() is called as the scan advances. Without commit() the
+    // ring grows and flush() resolves a whole list of matches at once.
+    class MatchResolver {
+    public:
+        MatchResolver(std::vector<Span>& ring, size_t window_size) : ring_(ring) {
+            ring_.resize(window_size);
+        }
+
+        void add(const Span& m) {
+            // Overlaps a match that was already emitted
+            if (m.norm_begin < emitted_end_) {
+                return;
+            }
+            // Pending candidates starting at or after m are contained in it,
+            // but only go away if no earlier candidate overlaps m and wins
+            size_t kept = count_;
+            while (kept > 0 && at(kept - 1).norm_begin >= m.norm_begin) {
+                kept--;
+            }
+            if (kept > 0 && at(kept - 1).norm_end >= m.norm_begin) {
+                return;
+            }
+            count_ = kept;
+            if (count_ == ring_.size()) {
+                grow();
+            }
+            ring_[(head_ + count_) & (ring_.size() - 1)] = m;
+            count_++;
+        }
+
+        // Emit the candidates no match ending at norm_pos or later can replace.
+        template <typename F>
+        void commit(size_t norm_pos, size_t max_length, F&& emit) {
+            while (count_ > 0 && ring_[head_].norm_begin + max_length <= norm_pos) {
+                pop_front(emit);
+            }
+        }
+
+        template <typename F>
+        void flush(F&& emit) {
+            while (count_ > 0) {
+                pop_front(emit);
+            }
+        }
+
+    private:
+        template <typename F>
+        void pop_front(F&& emit) {
+            emitted_end_ = ring_[head_].norm_end + 1;
+            emit(ring_[head_]);
+            head_ = (head_ + 1) & (ring_.size() - 1);
+            count_--;
+        }
+
+        const Span& at(size_t k) const { return ring_[(head_ + k) & (ring_.size() - 1)]; }
+
+        void grow() {
+            std::rotate(ring_.begin(), ring_.begin() + head_, ring_.end());
+            ring_.resize(ring_.size() * 2);
+            head_ = 0;
+        }
+
+        std::vector<Span>& ring_;
+        size_t head_{0};
+        size_t count_{0};
+        size_t emitted_end_{0};
+    };
+
+    // Writes text with resolved matches replaced, in one forward pass.
+    // Each replacement swallows the spaces around the match and is
+    // separated from neighbouring text by exactly one space. Positions are
+    // absolute byte offsets; the input may arrive in pieces (see Scanner),
+    // in which case input() holds the bytes from offset base on.
+    class ReplaceWriter {
+    public:
+        explicit ReplaceWriter(std::string_view replacement) : replacement_(replacement) {}
+
+        ReplaceWriter(std::string_view text, std::string_view replacement) : replacement_(replacement) {
+            input(text, 0);
+        }
+
+        void input(std::string_view text, size_t base) {
+            text_ = text;
+            base_ = base;
+        }
+
+        size_t copied() const { return copied_; }
+
+        void write(const Span& m, std::string& out) {
+            // Matches that share an expanded character (ß -> ss) may touch
+            size_t start = std::max(m.byte_begin, copied_);
+            size_t end = std::max(m.byte_end, copied_);
 
-        TrieNode() = default;
+            // Swallow the spaces before the match
+            size_t text_end = start;
+            while (text_end > copied_ && is_space_char(at(text_end - 1))) {
+                text_end--;
+            }
+            copy_until(text_end, out);
+
+            if (last_ != '\0' && !is_space_char(last_)) {
+                out.push_back(' ');
+            }
+            out.append(replacement_);
+            if (!replacement_.empty()) {
+                last_ = replacement_.back();
+            }
+            // The spaces after the match are dropped by the next copy
+            copied_ = end;
+            after_match_ = true;
+        }
+
+        // Copy the input up to byte offset limit.
+        void copy_until(size_t limit, std::string& out) {
+            if (after_match_) {
+                while (copied_ < limit && is_space_char(at(copied_))) {
+                    copied_++;
+                }
+                if (copied_ == limit) {
+                    return;
+                }
+                out.push_back(' ');
+                after_match_ = false;
+            }
+            if (copied_ < limit) {
+                out.append(text_.substr(copied_ - base_, limit - copied_));
+                last_ = at(limit - 1);
+                copied_ = limit;
+            }
+        }
+
+        void finish(std::string& out) {
+            copy_until(base_ + text_.size(), out);
+        }
+
+    private:
+        char at(size_t pos) const { return text_[pos - base_]; }
+
+        std::string_view text_;
+        size_t base_{0};
+        std::string_view replacement_;
+        size_t copied_{0};
+        // Last byte written, '\0' before any output
+        char last_{'\0'};
+        bool after_match_{false};
     };
 
-    static const std::unordered_set<char> DEFAULT_IGNORED_SYMBOLS;
-    std::unordered_set<char> ignored_symbols_;
-    std::unique_ptr<TrieNode> root;
-    std::vector<std::u32string> forbidden_words;
+    // Reusable buffers for one scan at a time, so repeated calls on the same
+    // thread (e.g. a batch worker) don't allocate per message.
+    struct Scratch {
+        std::vector<size_t> starts;
+        std::vector<char32_t> recent;
+        std::vector<Span> pending;
+        std::vector<Span> spans;
+        bool busy{false};
+    };
 
-    // UTF-8 conversion utilities
-    static std::u32string to_utf32(const std::string& s) {
-        std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-        return conv.from_bytes(s);
+    // Calls f(Scratch&) with this thread's scratch buffers, or fresh ones
+    // when a find_all() callback scans again on the same thread.
+    template <typename F>
+    static decltype(auto) with_thread_scratch(F&& f) {
+        thread_local Scratch scratch;
+        if (scratch.busy) {
+            Scratch nested;
+            return f(nested);
+        }
+        struct Release {
+            Scratch& s;
+            ~Release() { s.busy = false; }
+        } release{scratch};
+        scratch.busy = true;
+        return f(scratch);
     }
 
-    static std::string to_utf8(const std::u32string& s) {
-        std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> conv;
-        return conv.to_bytes(s);
+    // Position in the main and the delta automaton. With the prefilter, the
+    // automata only run from a candidate bigram until the longest word
+    // starting there would have ended; in between they rest at the root.
+    struct ScanPosition {
+        uint32_t main{Automaton::ROOT};
+        uint32_t delta{Automaton::ROOT};
+        char32_t prev{0};     // previous code point
+        size_t seen{0};       // code points seen
+        size_t run_until{0};  // last position the automata must see
+        bool running{false};
+        char32_t* recent{nullptr};  // last window_size_ code points; only for a minimized automaton
+        FORWORD_STATS(uint64_t failures{0};)
+    };
+
+    bool has_delta() const {
+        return !delta_words_.empty();
     }
 
-    // Normalize UTF-8 string with expansion and return mapping vector.
-    // For each code point appended to the normalized output, mapping[i] holds
-    // the index in the original UTF-32 string where that character came from.
-    static std::pair<std::string, std::vector<size_t>> normalize_utf8_with_mapping(const std::string & input) {
-        std::u32string utf32 = to_utf32(input);
-        std::u32string normalized;
-        normalized.reserve(utf32.size());
-        std::vector<size_t> mapping;
-        mapping.reserve(utf32.size());
-        
-        for (size_t i = 0; i < utf32.size(); i++) {
-            char32_t ch = utf32[i];
-            
-            // Convert to lowercase first
-            if (ch >= U'A' && ch <= U'Z') {
-                ch = ch - U'A' + U'a';
-            }
-            
-            // Map accented characters
-            switch(ch) {
-                // Unified accent mapping for all languages
-                // a with accents (French, Portuguese, German)
-                case U'à': case U'á': case U'â': case U'ã': case U'ä': ch = U'a'; break;
-                // e with accents (French, Portuguese)
-                case U'è': case U'é': case U'ê': case U'ë': ch = U'e'; break;
-                // i with accents (French, Portuguese)
-                case U'ì': case U'í': case U'î': case U'ï': ch = U'i'; break;
-                // o with accents (French, Portuguese)
-                case U'ò': case U'ó': case U'ô': case U'õ': case U'ö': ch = U'o'; break;
-                // u with accents (French, Portuguese, German)
-                case U'ù': case U'ú': case U'û': case U'ü': ch = U'u'; break;
-                // Other special characters
-                case U'ÿ': ch = U'y'; break;  // French
-                case U'ç': ch = U'c'; break;  // French, Portuguese
-                case U'ñ': ch = U'n'; break;  // Spanish 'ñ' -> 'n'
-                // For ß, expand to two 's' characters.
-                case U'ß': {
-                    normalized.push_back(U's');
-                    mapping.push_back(i);
-                    normalized.push_back(U's');
-                    mapping.push_back(i);
-                    continue;
+    // Feeds ch to the scan. Returns false when the prefilter skipped it,
+    // in which case no word ends at ch.
+    bool advance(ScanPosition& s, char32_t ch) const {
+        size_t pos = s.seen++;
+        if (s.recent) {
+            s.recent[pos & (window_size_ - 1)] = ch;
+        }
+        if (prefilter_.enabled()) {
+            char32_t prev = s.prev;
+            s.prev = ch;
+            if (pos > 0 && prefilter_.test(prev, ch)) {
+                if (!s.running) {
+                    s.main = Automaton::ROOT;
+                    s.delta = Automaton::ROOT;
+                    step(s, prev);
+                    s.running = true;
                 }
-                default:
-                    if(ch >= 0x0300 && ch <= 0x036F) continue;
+                s.run_until = pos + max_pattern_length_ - 2;
+            } else if (!s.running) {
+                return false;
             }
-            
-            normalized.push_back(ch);
-            mapping.push_back(i);
+            s.running = pos < s.run_until;
         }
-        
-        return { to_utf8(normalized), mapping };
+        step(s, ch);
+        return true;
     }
 
-    std::vector<std::u32string> load_forbidden_words(const std::string& file_path) {
-        std::vector<std::u32string> words;
-        std::unordered_map<std::string, std::string> normalized_to_original;
-        // Open file in binary mode
-        std::ifstream file(file_path, std::ios::binary);
-        
-        if (!file.is_open()) {
-            throw std::runtime_error("Failed to open forbidden words file: " + file_path);
+    void step(ScanPosition& s, char32_t ch) const {
+#if defined(FORWORD_ENABLE_STATS)
+        s.main = dense_.enabled() ? dense_.next(s.main, ch) : automaton_.next(s.main, ch, s.failures);
+        if (has_delta()) {
+            s.delta = delta_.next(s.delta, ch, s.failures);
         }
+#else
+        s.main = dense_.enabled() ? dense_.next(s.main, ch) : automaton_.next(s.main, ch);
+        if (has_delta()) {
+            s.delta = delta_.next(s.delta, ch);
+        }
+#endif
+    }
 
-        // Read first few bytes to check BOM
-        char bom[4] = {0};
-        file.read(bom, 4);
-        
-        // Determine encoding from BOM
-        enum class Encoding {
-            Unknown,
-            UTF8,
-            UTF16LE,
-            UTF16BE,
-            UTF32LE,
-            UTF32BE
-        } encoding = Encoding::Unknown;
-        
-        size_t bom_size = 0;
-        
-        if (bom[0] == (char)0xEF && bom[1] == (char)0xBB && bom[2] == (char)0xBF) {
-            encoding = Encoding::UTF8;
-            bom_size = 3;
-        }
-        else if (bom[0] == (char)0xFF && bom[1] == (char)0xFE) {
-            if (bom[2] == 0 && bom[3] == 0) {
-                encoding = Encoding::UTF32LE;
-                bom_size = 4;
+    // Builds dense_ from automaton_ if it fits in the budget. Call whenever
+    // automaton_ is replaced.
+    void build_dense_dfa() {
+        dense_ = DenseDfa();
+        const Automaton& a = automaton_;
+        const size_t states = a.state_count();
+        if (options_.dense_dfa_budget == 0 || states == 0) return;
+
+        std::vector<char32_t> labels(a.edge_label.begin(), a.edge_label.end());
+        std::sort(labels.begin(), labels.end());
+        labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+        auto astral_begin = std::lower_bound(labels.begin(), labels.end(), char32_t{0x10000});
+
+        auto arrays = std::make_shared<DenseDfa::Arrays>();
+        arrays->page_index.assign(DenseDfa::BMP_PAGES, 0);
+        arrays->pages.assign(DenseDfa::PAGE_SIZE, 0);
+        uint32_t cls = 1;
+        for (auto it = labels.begin(); it != astral_begin; ++it, ++cls) {
+            uint32_t& page = arrays->page_index[*it >> DenseDfa::PAGE_BITS];
+            if (page == 0) {
+                page = static_cast<uint32_t>(arrays->pages.size() >> DenseDfa::PAGE_BITS);
+                arrays->pages.resize(arrays->pages.size() + DenseDfa::PAGE_SIZE, 0);
+            }
+            arrays->pages[(page << DenseDfa::PAGE_BITS) | (*it & (DenseDfa::PAGE_SIZE - 1))] = cls;
+        }
+        arrays->astral.assign(astral_begin, labels.end());
+
+        DenseDfa d;
+        d.bmp_classes = cls;
+        d.classes = cls + static_cast<uint32_t>(arrays->astral.size());
+        d.attach(arrays);
+        if (states * d.classes * sizeof(uint32_t) + d.bytes() > options_.dense_dfa_budget) return;
+
+        // BFS order puts every failure target before the states failing to
+        // it, so a row starts as a copy of the finished row of its failure
+        // state (load_compiled() has checked that order for mapped files).
+        arrays->table.assign(states * d.classes, Automaton::ROOT);
+        uint32_t* table = arrays->table.data();
+        for (uint32_t state = 0; state < states; state++) {
+            uint32_t* row = table + static_cast<size_t>(state) * d.classes;
+            if (state != Automaton::ROOT) {
+                std::copy_n(table + static_cast<size_t>(a.fail[state]) * d.classes, d.classes, row);
+            }
+            for (uint32_t e = a.edge_begin[state]; e < a.edge_begin[state + 1]; e++) {
+                row[d.classify(a.edge_label[e])] = a.edge_target[e];
+            }
+        }
+        d.attach(arrays);
+        dense_ = std::move(d);
+    }
+
+    // Collects the leading bigrams of both automata: the labels of every
+    // path of length two from the root.
+    void build_prefilter() {
+        prefilter_ = Prefilter();
+        if (!options_.prefilter) return;
+
+        std::vector<std::pair<char32_t, char32_t>> bigrams;
+        for (const Automaton* a : {&automaton_, &delta_}) {
+            if (a->state_count() == 0) continue;
+            for (uint32_t e = a->edge_begin[Automaton::ROOT]; e < a->edge_begin[Automaton::ROOT + 1]; e++) {
+                uint32_t first = a->edge_target[e];
+                if (a->output[first] != Automaton::NO_PATTERN) return;  // single-character word
+                for (uint32_t f = a->edge_begin[first]; f < a->edge_begin[first + 1]; f++) {
+                    bigrams.emplace_back(a->edge_label[e], a->edge_label[f]);
+                }
+            }
+        }
+        if (bigrams.empty()) return;
+
+        // About 64 bits per bigram keeps false candidates near 1.5% per
+        // position; past a fill of 1/8 the filter is not worth its lookups.
+        uint32_t log2 = Prefilter::MIN_BITS_LOG2;
+        while (log2 < Prefilter::MAX_BITS_LOG2 && (size_t{1} << log2) < bigrams.size() * 64) log2++;
+        if (bigrams.size() * 8 > (size_t{1} << log2)) return;
+
+        auto bits = std::make_shared<std::vector<uint64_t>>((size_t{1} << log2) / 64, 0);
+        prefilter_.shift = 32 - log2;
+        for (const auto& [a, b] : bigrams) {
+            uint32_t k = prefilter_.slot(a, b);
+            (*bits)[k >> 6] |= uint64_t{1} << (k & 63);
+        }
+        prefilter_.attach(std::move(bits));
+    }
+
+    // Gives s the ring of recent code points that a minimized automaton
+    // needs to tell its words apart.
+    void keep_recent(ScanPosition& s, std::vector<char32_t>& ring) const {
+        if (automaton_.minimized()) {
+            ring.resize(window_size_);
+            s.recent = ring.data();
+        }
+    }
+
+    // ID of the word of the minimized main automaton that ends at s and is
+    // length code points long.
+    uint32_t recent_pattern(const ScanPosition& s, uint32_t length) const {
+        const size_t mask = window_size_ - 1;
+        uint64_t hash = Automaton::HASH_SEED;
+        for (size_t pos = s.seen - length; pos < s.seen; pos++) {
+            hash = Automaton::hash_step(hash, s.recent[pos & mask]);
+        }
+        return automaton_.find_word(hash);
+    }
+
+    // Calls f(pattern_id, length) for every word that is still in the
+    // dictionary and ends at s: main automaton first, longest first within each.
+    template <typename F>
+    void for_each_output(const ScanPosition& s, F&& f) const {
+        if (automaton_.has_output(s.main)) {
+            automaton_.for_each_output(s.main, [&](uint32_t pattern_id, uint32_t length) {
+                if (pattern_id == Automaton::NO_PATTERN) pattern_id = recent_pattern(s, length);
+                if (removed_count_ == 0 || !removed_[pattern_id]) f(pattern_id, length);
+            });
+        }
+        if (has_delta() && delta_.has_output(s.delta)) {
+            const uint32_t base = static_cast<uint32_t>(automaton_.pattern_count());
+            delta_.for_each_output(s.delta, [&](uint32_t pattern_id, uint32_t length) {
+                f(base + pattern_id, length);
+            });
+        }
+    }
+
+    bool has_output(const ScanPosition& s) const {
+        if (removed_count_ == 0) {
+            return automaton_.has_output(s.main) || (has_delta() && delta_.has_output(s.delta));
+        }
+        bool found = false;
+        for_each_output(s, [&](uint32_t, uint32_t) { found = true; });
+        return found;
+    }
+
+    // Walks the automaton over text and calls f(span, pattern_id) for every
+    // match in order of end position (longest first at the same end).
+    // Stops early and returns false when f returns false.
+    template <typename F>
+    bool for_each_match(std::string_view text, Scratch& scratch, F&& f) const {
+        ScanPosition state;
+        keep_recent(state, scratch.recent);
+        return for_each_match(text, scratch, state, f);
+    }
+
+    // Same, continuing from state. Normalized positions go on from
+    // state.seen; a match that started before text gets byte_begin 0.
+    template <typename F>
+    bool for_each_match(std::string_view text, Scratch& scratch, ScanPosition& state, F&& f) const {
+        // Byte offset where each of the most recent normalized code points
+        // started; a match never reaches further back than the longest pattern.
+        std::vector<size_t>& starts = scratch.starts;
+        starts.resize(window_size_);
+        const size_t mask = window_size_ - 1;
+        const size_t first = state.seen;
+
+        bool completed = for_each_normalized(text, [&](char32_t ch, size_t begin, size_t end) {
+            const size_t pos = state.seen;
+            starts[pos & mask] = begin;
+            bool keep_going = true;
+            if (advance(state, ch) && has_output(state)) {
+                for_each_output(state, [&](uint32_t pattern_id, uint32_t length) {
+                    size_t norm_begin = pos + 1 - length;
+                    size_t byte_begin = norm_begin < first ? 0 : starts[norm_begin & mask];
+                    FORWORD_STATS(if (keep_going) stats_.add_match(pattern_id);)
+                    keep_going = keep_going && f(Span{norm_begin, pos, byte_begin, end}, pattern_id);
+                });
+            }
+            return keep_going;
+        });
+        FORWORD_STATS(stats_.add_failures(state.failures); state.failures = 0;)
+        return completed;
+    }
+
+    bool search_text(std::string_view text) const {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Scan);)
+        // Normalize and scan in a single pass, stopping at the first hit
+        ScanPosition state;
+        bool found = false;
+        auto scan = [&] {
+            for_each_normalized(text, [&](char32_t ch, size_t, size_t) {
+                found = advance(state, ch) && has_output(state);
+                return !found;
+            });
+        };
+        if (automaton_.minimized()) {
+            with_thread_scratch([&](Scratch& scratch) {
+                keep_recent(state, scratch.recent);
+                scan();
+            });
+        } else {
+            scan();
+        }
+        FORWORD_STATS(stats_.add_failures(state.failures);)
+        return found;
+    }
+
+    // Calls scan(scratch, position) with state's position in this dictionary
+    // and the ring of recent code points filled from its tail, then stores
+    // the new position and tail back in state.
+    template <typename F>
+    void continue_scan(ScanState& state, F&& scan) const {
+        with_thread_scratch([&](Scratch& scratch) {
+            std::vector<char32_t>& ring = scratch.recent;
+            ring.resize(window_size_);
+            const size_t mask = window_size_ - 1;
+            std::u32string& tail = state.tail_;
+
+            ScanPosition position;
+            if (state.dictionary_ == dictionary_id_) {
+                position = state.position_;
+                position.recent = ring.data();
+                for (size_t i = 0; i < tail.size(); i++) {
+                    ring[(position.seen - tail.size() + i) & mask] = tail[i];
+                }
             } else {
-                encoding = Encoding::UTF16LE;
-                bom_size = 2;
+                position.recent = ring.data();
+                for (char32_t ch : tail) advance(position, ch);
+                FORWORD_STATS(position.failures = 0;)
+            }
+            const size_t kept = tail.size();
+            const size_t before = position.seen;
+
+            scan(scratch, position);
+
+            const size_t keep = std::min(kept + (position.seen - before), max_pattern_length_ > 0 ? max_pattern_length_ - 1 : 0);
+            tail.resize(keep);
+            for (size_t i = 0; i < keep; i++) {
+                tail[i] = ring[(position.seen - keep + i) & mask];
             }
+            position.recent = nullptr;
+            state.position_ = position;
+            state.dictionary_ = dictionary_id_;
+        });
+    }
+
+    // Bodies of replace_into() and find_all() for a given set of buffers.
+    void replace_with(std::string_view text, std::string& out, std::string_view replacement, Scratch& scratch) const {
+        out.clear();
+        if (!text.empty()) {
+            replace_text(text, replacement, out, scratch);
         }
-        else if (bom[0] == (char)0xFE && bom[1] == (char)0xFF) {
-            encoding = Encoding::UTF16BE;
-            bom_size = 2;
+    }
+
+    template <typename F>
+    bool find_all_with(std::string_view text, Scratch& scratch, F& on_match) const {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Scan);)
+        return for_each_match(text, scratch, [&](const Span& span, uint32_t pattern_id) {
+            Match m{span.byte_begin, span.byte_end, pattern_id};
+            if constexpr (std::is_same_v<decltype(on_match(m)), bool>) {
+                return on_match(m);
+            } else {
+                on_match(m);
+                return true;
+            }
+        });
+    }
+
+    // Appends text with all matches replaced to out.
+    void replace_text(std::string_view text, std::string_view replacement, std::string& out, Scratch& scratch) const {
+        ScanPosition state;
+        keep_recent(state, scratch.recent);
+        replace_text(text, replacement, out, scratch, state);
+    }
+
+    void replace_text(std::string_view text, std::string_view replacement, std::string& out, Scratch& scratch,
+                      ScanPosition& state) const {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Replace);)
+        const size_t max_length = max_pattern_length_;
+        ReplaceWriter writer(text, replacement);
+        MatchResolver resolver(scratch.pending, window_size_);
+        auto write = [&](const Span& m) { writer.write(m, out); };
+
+        // Resolve overlaps during the walk and write the output once
+        for_each_match(text, scratch, state, [&](const Span& m, uint32_t) {
+            resolver.commit(m.norm_end, max_length, write);
+            resolver.add(m);
+            return true;
+        });
+        resolver.flush(write);
+        writer.finish(out);
+    }
+
+    // Work item of a batch call: either a group of whole messages
+    // [first, last), or the bytes [begin, end) of the single split message first.
+    struct BatchTask {
+        size_t first;
+        size_t last;
+        size_t begin;
+        size_t end;
+        bool piece;
+    };
+
+    // Move pos forward to the start of a UTF-8 character.
+    static size_t utf8_boundary(std::string_view text, size_t pos) {
+        for (int k = 0; k < 3 && pos < text.size() &&
+                        (static_cast<unsigned char>(text[pos]) & 0xC0) == 0x80; k++) {
+            pos++;
         }
-        else if (bom[0] == 0 && bom[1] == 0 && bom[2] == (char)0xFE && bom[3] == (char)0xFF) {
-            encoding = Encoding::UTF32BE;
-            bom_size = 4;
+        return pos;
+    }
+
+    // Where a piece of a split message starting at split must start scanning
+    // so that every match ending inside the piece is seen: far enough back to
+    // cover max_pattern_length - 1 normalized code points.
+    size_t warmup_start(std::string_view text, size_t split) const {
+        size_t need = max_pattern_length_ > 0 ? max_pattern_length_ - 1 : 0;
+        size_t i = split;
+        while (i > 0 && need > 0) {
+            size_t begin = i - 1;
+            while (begin > 0 && i - begin < 4 && (static_cast<unsigned char>(text[begin]) & 0xC0) == 0x80) {
+                begin--;
+            }
+            size_t next = begin;
+            char32_t ch = decode_utf8(text, next);
+            if (next != i) {
+                begin = i - 1;
+                ch = 0xFFFD;
+            }
+
+            char32_t folded[forword_fold::MAX_EXPANSION];
+            size_t count = fold_char(ch, folded);
+            for (size_t k = 0; k < count && need > 0; k++) {
+                if (!is_ignored(folded[k])) need--;
+            }
+            i = begin;
         }
-        else {
-            // No BOM found, assume UTF-8
-            encoding = Encoding::UTF8;
-            bom_size = 0;
+        return i;
+    }
+
+    // Group small messages into tasks of about BATCH_GROUP_BYTES and split
+    // messages larger than BATCH_SPLIT_BYTES into pieces.
+    template <typename Texts>
+    static std::vector<BatchTask> plan_batch(const Texts& texts) {
+        std::vector<BatchTask> tasks;
+        const size_t count = std::size(texts);
+        size_t group_first = 0;
+        size_t group_bytes = 0;
+
+        for (size_t i = 0; i < count; i++) {
+            std::string_view text(texts[i]);
+            if (text.size() > BATCH_SPLIT_BYTES) {
+                if (group_first < i) tasks.push_back({group_first, i, 0, 0, false});
+                for (size_t begin = 0; begin < text.size();) {
+                    size_t end = utf8_boundary(text, std::min(text.size(), begin + BATCH_SPLIT_BYTES));
+                    tasks.push_back({i, i + 1, begin, end, true});
+                    begin = end;
+                }
+                group_first = i + 1;
+                group_bytes = 0;
+                continue;
+            }
+
+            // Per-message overhead counts too, so tiny messages still get grouped sensibly
+            group_bytes += text.size() + 64;
+            if (group_bytes >= BATCH_GROUP_BYTES) {
+                tasks.push_back({group_first, i + 1, 0, 0, false});
+                group_first = i + 1;
+                group_bytes = 0;
+            }
         }
+        if (group_first < count) tasks.push_back({group_first, count, 0, 0, false});
 
-        // Reset file position after BOM
-        file.clear();
-        file.seekg(bom_size);
-        
-        // Read file content based on encoding
-        std::string line;
-        std::vector<char> buffer;
-        buffer.resize(1024);  // Initial buffer size
-        
-        while (true) {
-            if (encoding == Encoding::UTF8) {
-                if (!std::getline(file, line)) break;
-            }
-            else {
-                // Read appropriate number of bytes based on encoding
-                size_t char_size = (encoding == Encoding::UTF16LE || encoding == Encoding::UTF16BE) ? 2 : 4;
-                file.read(buffer.data(), char_size);
-                if (file.gcount() < (long)char_size) break;
-                
-                // Convert to UTF-8
-                if (encoding == Encoding::UTF16LE) {
-                    uint16_t ch = *reinterpret_cast<uint16_t*>(buffer.data());
-                    line.push_back(ch & 0xFF);
-                    line.push_back((ch >> 8) & 0xFF);
-                }
-                else if (encoding == Encoding::UTF16BE) {
-                    uint16_t ch = *reinterpret_cast<uint16_t*>(buffer.data());
-                    ch = ((ch & 0xFF) << 8) | ((ch >> 8) & 0xFF);
-                    line.push_back(ch & 0xFF);
-                    line.push_back((ch >> 8) & 0xFF);
-                }
-                // Similar handling for UTF32...
-            }
-            
-            // Trim whitespace from both ends
-            line.erase(0, line.find_first_not_of(" \t\n\r"));
-            line.erase(line.find_last_not_of(" \t\n\r") + 1);
-            
-            if (!line.empty()) {  // Skip empty lines after trimming
-                // First normalize UTF-8 string to handle accents
-                auto normalized_utf8 = Forword::normalize_utf8(line);
-                // Then convert to UTF-32 and normalize spaces/symbols
-                auto utf32_word = to_utf32(normalized_utf8);
-                // 금칙어는 항상 기본 정규화 규칙을 사용
-                std::u32string normalized_word;
-                for (char32_t ch : utf32_word) {
-                    if (ch >= U'A' && ch <= U'Z') {
-                        ch = ch - U'A' + U'a';
-                    }
-                    if (ch >= 0x0300 && ch <= 0x036F) {
-                        continue;
-                    }
-                    if (DEFAULT_IGNORED_SYMBOLS.find(to_utf8(std::u32string(1, ch))[0]) == 
-                        DEFAULT_IGNORED_SYMBOLS.end() && 
-                        is_word_char(ch)) {
-                        normalized_word.push_back(ch);
-                    }
+        return tasks;
+    }
+
+    // Matches ending inside one piece of a split message, with byte
+    // coordinates in the whole message and normalized coordinates relative
+    // to the first normalized code point of the piece; returns the number of
+    // normalized code points in the piece. Normalization works one character
+    // at a time, so adding the lengths of the pieces before gives the
+    // normalized offset that makes these coordinates match a scan of the
+    // whole message, and the pieces resolve together exactly like replace()
+    // (folds such as ß -> ss let matches share bytes but not code points).
+    // Matches starting in the warmup before the piece wrap below zero; the
+    // unsigned addition of the offset undoes that.
+    size_t collect_piece_spans(std::string_view text, const BatchTask& task, std::vector<Span>& spans,
+                               Scratch& scratch) const {
+        size_t start = warmup_start(text, task.begin);
+        size_t warmup = 0;
+        for_each_normalized(text.substr(start, task.begin - start), [&](char32_t, size_t, size_t) {
+            warmup++;
+            return true;
+        });
+
+        ScanPosition state;
+        keep_recent(state, scratch.recent);
+        for_each_match(text.substr(start, task.end - start), scratch, state, [&](const Span& m, uint32_t) {
+            if (start + m.byte_end > task.begin) {
+                spans.push_back({m.norm_begin - warmup, m.norm_end - warmup, start + m.byte_begin, start + m.byte_end});
+            }
+            return true;
+        });
+        return state.seen - warmup;
+    }
+
+    // Fold case and accents, then drop spaces, symbols and non-word characters.
+    // 금칙어는 항상 기본 정규화 규칙을 사용
+    std::u32string normalize_dictionary_word(std::string_view word) const {
+        std::u32string normalized_word;
+        for_each_folded(word, [&](char32_t ch, size_t, size_t) {
+            if (!DEFAULT_IGNORED_SYMBOLS.contains(ch) && is_word_char(ch)) {
+                normalized_word.push_back(ch);
+            }
+            return true;
+        });
+        return normalized_word;
+    }
+
+    // Encodings of a forbidden words file, told apart by their byte order
+    // mark; files without one are read as UTF-8.
+    enum class TextEncoding { UTF8, UTF16LE, UTF16BE, UTF32LE, UTF32BE };
+
+    static TextEncoding detect_encoding(std::string_view bytes, size_t& bom_size) {
+        auto starts_with = [&](std::initializer_list<unsigned char> bom) {
+            return bytes.size() >= bom.size() &&
+                   std::equal(bom.begin(), bom.end(), bytes.begin(),
+                              [](unsigned char b, char c) { return b == static_cast<unsigned char>(c); });
+        };
+        bom_size = 4;
+        if (starts_with({0xFF, 0xFE, 0x00, 0x00})) return TextEncoding::UTF32LE;
+        if (starts_with({0x00, 0x00, 0xFE, 0xFF})) return TextEncoding::UTF32BE;
+        bom_size = 3;
+        if (starts_with({0xEF, 0xBB, 0xBF})) return TextEncoding::UTF8;
+        bom_size = 2;
+        if (starts_with({0xFF, 0xFE})) return TextEncoding::UTF16LE;
+        if (starts_with({0xFE, 0xFF})) return TextEncoding::UTF16BE;
+        bom_size = 0;
+        return TextEncoding::UTF8;
+    }
+
+    // Code unit k of a UTF-16 or UTF-32 byte sequence in the given byte order.
+    template <size_t UnitSize, bool BigEndian>
+    static char32_t code_unit(const unsigned char* p, size_t k) {
+        p += k * UnitSize;
+        char32_t unit = 0;
+        for (size_t b = 0; b < UnitSize; b++) {
+            unit |= static_cast<char32_t>(p[BigEndian ? b : UnitSize - 1 - b]) << (8 * (UnitSize - 1 - b));
+        }
+        return unit;
+    }
+
+    // Appends UTF-16 or UTF-32 text to out as UTF-8. Blocks of ASCII code
+    // units are copied without decoding. Unpaired surrogates, values past
+    // U+10FFFF and a truncated last unit become U+FFFD.
+    template <size_t UnitSize, bool BigEndian>
+    static void transcode_to_utf8(std::string_view bytes, std::string& out) {
+        constexpr size_t BLOCK = 16;
+        const auto* p = reinterpret_cast<const unsigned char*>(bytes.data());
+        const size_t units = bytes.size() / UnitSize;
+        out.reserve(out.size() + units * (UnitSize == 2 ? 3 : 4));
+
+        size_t i = 0;
+        while (i < units) {
+            if (units - i >= BLOCK) {
+                char32_t any = 0;
+                char ascii[BLOCK];
+                for (size_t k = 0; k < BLOCK; k++) {
+                    char32_t unit = code_unit<UnitSize, BigEndian>(p, i + k);
+                    any |= unit;
+                    ascii[k] = static_cast<char>(unit);
+                }
+                if (any < 0x80) {
+                    out.append(ascii, BLOCK);
+                    i += BLOCK;
+                    continue;
                 }
-                
-                // Convert normalized word back to string for comparison
-                std::string normalized_str = to_utf8(normalized_word);
-                
-                // Check if this normalized form already exists
-                auto it = normalized_to_original.find(normalized_str);
-                if (it != normalized_to_original.end()) {
-                    std::cerr << "Warning: '" << line << "' is equivalent to existing word '" 
-                             << it->second << "' after normalization\n";
-                    continue;  // Skip this word
+            }
+
+            char32_t ch = code_unit<UnitSize, BigEndian>(p, i++);
+            if (UnitSize == 2 && ch >= 0xD800 && ch <= 0xDBFF && i < units) {
+                char32_t low = code_unit<UnitSize, BigEndian>(p, i);
+                if (low >= 0xDC00 && low <= 0xDFFF) {
+                    ch = 0x10000 + ((ch - 0xD800) << 10) + (low - 0xDC00);
+                    i++;
                 }
-                
-                // Store the mapping and add the word
-                normalized_to_original[normalized_str] = line;
-                words.push_back(normalized_word);
+            }
+            if ((ch >= 0xD800 && ch <= 0xDFFF) || ch > 0x10FFFF) {
+                ch = 0xFFFD;
+            }
+            append_utf8(out, ch);
+        }
+        if (bytes.size() % UnitSize != 0) {
+            append_utf8(out, 0xFFFD);
+        }
+    }
+
+    // Work units of a parallel build: lines normalized per task, and states
+    // per task within one level of the failure link pass.
+    static constexpr size_t BUILD_CHUNK = 1024;
+    static constexpr uint32_t LINK_CHUNK = 4096;
+
+    // Splits a word list into trimmed, non-empty lines. A UTF-16/32 list is
+    // converted to UTF-8 into storage first; the lines point into bytes or
+    // storage.
+    static std::vector<std::string_view> read_word_lines(std::string_view bytes, std::string& storage) {
+        size_t bom_size;
+        TextEncoding encoding = detect_encoding(bytes, bom_size);
+        bytes.remove_prefix(bom_size);
+
+        switch (encoding) {
+            case TextEncoding::UTF8: break;
+            case TextEncoding::UTF16LE: transcode_to_utf8<2, false>(bytes, storage); break;
+            case TextEncoding::UTF16BE: transcode_to_utf8<2, true>(bytes, storage); break;
+            case TextEncoding::UTF32LE: transcode_to_utf8<4, false>(bytes, storage); break;
+            case TextEncoding::UTF32BE: transcode_to_utf8<4, true>(bytes, storage); break;
+        }
+        std::string_view text = encoding == TextEncoding::UTF8 ? bytes : std::string_view(storage);
+
+        std::vector<std::string_view> lines;
+        lines.reserve(static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
+        constexpr std::string_view WHITESPACE = " \t\n\r";
+        while (!text.empty()) {
+            const void* newline = std::memchr(text.data(), '\n', text.size());
+            size_t length = newline ? static_cast<const char*>(newline) - text.data() : text.size();
+            std::string_view line = text.substr(0, length);
+            text.remove_prefix(newline ? length + 1 : length);
+
+            // Trim whitespace from both ends and skip empty lines
+            size_t first = line.find_first_not_of(WHITESPACE);
+            if (first == std::string_view::npos) continue;
+            lines.push_back(line.substr(first, line.find_last_not_of(WHITESPACE) - first + 1));
+        }
+        return lines;
+    }
+
+    // Returns the normalized words of lines, in order; originals receives
+    // the same words as written. Lines are normalized in chunks and
+    // deduplicated in shards by hash, on pool when there is one. A later
+    // line equivalent to an earlier one is dropped with a warning.
+    std::vector<std::u32string> normalize_word_lines(const std::vector<std::string_view>& lines,
+                                                     std::vector<std::string>& originals, ThreadPool* pool) const {
+        const size_t count = lines.size();
+        std::vector<std::u32string> normalized(count);
+        std::vector<size_t> hashes(count);
+        for_each_index(pool, (count + BUILD_CHUNK - 1) / BUILD_CHUNK, [&](size_t chunk) {
+            for (size_t i = chunk * BUILD_CHUNK; i < std::min(count, (chunk + 1) * BUILD_CHUNK); i++) {
+                normalized[i] = normalize_dictionary_word(lines[i]);
+                hashes[i] = std::hash<std::u32string>()(normalized[i]);
+            }
+        });
+
+        // Every shard sees its lines in file order, so first_of[i] is the
+        // first line equivalent to line i
+        const size_t shards = pool ? pool->size() : 1;
+        std::vector<std::vector<uint32_t>> shard_lines(shards);
+        for (uint32_t i = 0; i < count; i++) {
+            if (!normalized[i].empty()) {  // empty: only symbols; would match everywhere
+                shard_lines[hashes[i] % shards].push_back(i);
             }
         }
+        std::vector<uint32_t> first_of(count);
+        for_each_index(pool, shards, [&](size_t shard) {
+            std::unordered_map<std::u32string_view, uint32_t> seen;
+            seen.reserve(shard_lines[shard].size());
+            for (uint32_t i : shard_lines[shard]) {
+                first_of[i] = seen.try_emplace(normalized[i], i).first->second;
+            }
+        });
 
+        std::vector<std::u32string> words;
+        words.reserve(count);
+        originals.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            if (normalized[i].empty()) continue;
+            if (first_of[i] != i) {
+                std::cerr << "Warning: '" << lines[i] << "' is equivalent to existing word '"
+                          << lines[first_of[i]] << "' after normalization\n";
+                continue;  // Skip this word
+            }
+            words.push_back(std::move(normalized[i]));
+            originals.emplace_back(lines[i]);
+        }
         return words;
     }
 
-    void build_trie() {
-        root = std::make_unique<TrieNode>();
-        root->is_root = true;
+    // Pool for building a dictionary of this many words, or null when the
+    // dictionary is too small to be worth the threads.
+    std::unique_ptr<ThreadPool> make_build_pool(size_t words) const {
+        size_t threads = options_.build_threads != 0 ? options_.build_threads : std::thread::hardware_concurrency();
+        if (threads <= 1 || words < PARALLEL_BUILD_MIN_WORDS) return nullptr;
+        return std::make_unique<ThreadPool>(threads);
+    }
+
+    // Runs f(index) for every index in [0, count), on pool if there is one.
+    template <typename F>
+    static void for_each_index(ThreadPool* pool, size_t count, F&& f) {
+        if (pool == nullptr) {
+            for (size_t i = 0; i < count; i++) f(i);
+            return;
+        }
+        pool->parallel_for(count, [&](size_t i, size_t) { f(i); });
+    }
+
+    static Automaton build_automaton(const std::vector<std::u32string>& words,
+                                     const std::vector<std::string>& originals, ThreadPool* pool = nullptr) {
+        Automaton a;
+        auto arrays = std::make_shared<Automaton::Arrays>();
+        build_trie(a, words, originals, *arrays, pool);
+        a.attach(arrays);
+        build_failure_links(a, *arrays, pool);
+        return a;
+    }
+
+    // Words are grouped by their first code point and every group becomes
+    // one subtree of the root, built on its own arena (in parallel with a
+    // pool) and then copied behind the root. Within a group words are
+    // inserted in sorted order, so every node's children arrive in label
+    // order and a word only has to be matched against the path of the word
+    // before it: no child lookups at all.
+    static void build_trie(Automaton& a, const std::vector<std::u32string>& words,
+                           const std::vector<std::string>& originals, Automaton::Arrays& arrays,
+                           ThreadPool* pool) {
+        std::vector<uint32_t> sorted(words.size());
+        for (uint32_t id = 0; id < sorted.size(); id++) {
+            sorted[id] = id;
+        }
+        // Stable, so IDs stay ascending within a group and the first of
+        // equal words keeps the node. Empty words sort first.
+        std::stable_sort(sorted.begin(), sorted.end(), [&](uint32_t x, uint32_t y) {
+            return !words[y].empty() && (words[x].empty() || words[x][0] < words[y][0]);
+        });
+
+        TrieArena trie;
+        trie.nodes.push_back(TrieArena::Node{0, TrieArena::NONE, TrieArena::NONE, TrieArena::NONE, Automaton::NO_PATTERN});
+        size_t begin = 0;
+        while (begin < sorted.size() && words[sorted[begin]].empty()) {
+            begin++;
+        }
+        if (begin > 0) {
+            trie.nodes[0].pattern_id = sorted[0];
+        }
+
+        std::vector<std::pair<size_t, size_t>> groups;  // ranges of sorted
+        for (size_t end = begin; begin < sorted.size(); begin = end) {
+            while (end < sorted.size() && words[sorted[end]][0] == words[sorted[begin]][0]) {
+                end++;
+            }
+            groups.emplace_back(begin, end);
+        }
+
+        std::vector<TrieArena> subtries(groups.size());
+        for_each_index(pool, groups.size(), [&](size_t g) {
+            auto first = sorted.begin() + groups[g].first;
+            auto last = sorted.begin() + groups[g].second;
+            std::stable_sort(first, last, [&](uint32_t x, uint32_t y) { return words[x] < words[y]; });
+
+            size_t characters = 0;
+            for (auto it = first; it != last; ++it) {
+                characters += words[*it].size();
+            }
+            TrieArena& sub = subtries[g];
+            sub.nodes.reserve(characters);
+            sub.nodes.push_back(TrieArena::Node{words[*first][0], TrieArena::NONE, TrieArena::NONE, TrieArena::NONE,
+                                                Automaton::NO_PATTERN});
+
+            std::vector<uint32_t> path{0};  // nodes of the previous word, path[k] at depth k + 1
+            const std::u32string* previous = nullptr;
+            for (auto it = first; it != last; ++it) {
+                const std::u32string& word = words[*it];
+                size_t common = 1;
+                if (previous != nullptr) {
+                    while (common < word.size() && common < previous->size() && word[common] == (*previous)[common]) {
+                        common++;
+                    }
+                }
+                path.resize(common);
+                for (size_t depth = common; depth < word.size(); depth++) {
+                    path.push_back(sub.append_child(path.back(), word[depth]));
+                }
+                if (sub.nodes[path.back()].pattern_id == Automaton::NO_PATTERN) {
+                    sub.nodes[path.back()].pattern_id = *it;
+                }
+                previous = &word;
+            }
+        });
+
+        // Subtrees go behind the root in label order
+        std::vector<uint32_t> offsets(subtries.size());
+        size_t states = 1;
+        for (size_t g = 0; g < subtries.size(); g++) {
+            offsets[g] = static_cast<uint32_t>(states);
+            states += subtries[g].nodes.size();
+        }
+        trie.nodes.resize(states);
+        for_each_index(pool, subtries.size(), [&](size_t g) {
+            const uint32_t offset = offsets[g];
+            auto shift = [offset](uint32_t index) { return index == TrieArena::NONE ? index : index + offset; };
+            TrieArena::Node* out = trie.nodes.data() + offset;
+            for (const TrieArena::Node& node : subtries[g].nodes) {
+                *out++ = TrieArena::Node{node.label, shift(node.first_child), shift(node.last_child),
+                                         shift(node.next_sibling), node.pattern_id};
+            }
+            trie.nodes[offset].next_sibling = g + 1 < offsets.size() ? offsets[g + 1] : TrieArena::NONE;
+            subtries[g] = TrieArena();
+        });
+        if (!offsets.empty()) {
+            trie.nodes[0].first_child = offsets.front();
+            trie.nodes[0].last_child = offsets.back();
+        }
+
+        freeze_trie(a, trie, words, originals, arrays);
+    }
+
+    // Flatten the trie into arrays in BFS order with sorted edges.
+    static void freeze_trie(Automaton& a, const TrieArena& trie, const std::vector<std::u32string>& words,
+                            const std::vector<std::string>& originals, Automaton::Arrays& arrays) {
+        const size_t states = trie.nodes.size();
+        arrays.edge_begin.reserve(states + 1);
+        arrays.edge_label.reserve(states - 1);
+        arrays.edge_target.reserve(states - 1);
+        arrays.output.reserve(states);
+
+        std::vector<uint32_t> order{0};
+        order.reserve(states);
+        for (size_t i = 0; i < order.size(); i++) {
+            const TrieArena::Node& node = trie.nodes[order[i]];
+            arrays.edge_begin.push_back(static_cast<uint32_t>(arrays.edge_label.size()));
+            for (uint32_t child = node.first_child; child != TrieArena::NONE; child = trie.nodes[child].next_sibling) {
+                arrays.edge_label.push_back(trie.nodes[child].label);
+                arrays.edge_target.push_back(static_cast<uint32_t>(order.size()));
+                order.push_back(child);
+            }
+            arrays.output.push_back(node.pattern_id);
+        }
+        arrays.edge_begin.push_back(static_cast<uint32_t>(arrays.edge_label.size()));
+        arrays.fail.assign(order.size(), Automaton::ROOT);
+        arrays.dict_link.assign(order.size(), Automaton::NO_STATE);
+        arrays.pattern_length.reserve(words.size());
+        for (const auto& word : words) {
+            arrays.pattern_length.push_back(static_cast<uint32_t>(word.size()));
+            a.max_pattern_length = std::max(a.max_pattern_length, word.size());
+            while (a.window_size < word.size()) {
+                a.window_size <<= 1;
+            }
+        }
+        size_t text_size = 0;
+        for (const auto& original : originals) {
+            text_size += original.size();
+        }
+        arrays.word_text.reserve(text_size);
+        arrays.word_offset.reserve(originals.size() + 1);
+        arrays.word_offset.push_back(0);
+        for (const auto& original : originals) {
+            arrays.word_text.insert(arrays.word_text.end(), original.begin(), original.end());
+            arrays.word_offset.push_back(static_cast<uint32_t>(arrays.word_text.size()));
+        }
+    }
+
+    // Fills in arrays.fail and arrays.dict_link; a must already be attached
+    // to arrays.
+    static void build_failure_links(const Automaton& a, Automaton::Arrays& arrays, ThreadPool* pool) {
+        auto link_children = [&](uint32_t state) {
+            for (uint32_t e = a.edge_begin[state]; e < a.edge_begin[state + 1]; e++) {
+                char32_t ch = a.edge_label[e];
+                uint32_t child = a.edge_target[e];
+
+                if (state == Automaton::ROOT) {
+                    arrays.fail[child] = Automaton::ROOT;
+                    continue;
+                }
+
+                uint32_t failure = a.fail[state];
+                uint32_t target = a.child(failure, ch);
+                while (target == Automaton::NO_STATE && failure != Automaton::ROOT) {
+                    failure = a.fail[failure];
+                    target = a.child(failure, ch);
+                }
+                arrays.fail[child] = target == Automaton::NO_STATE ? Automaton::ROOT : target;
+
+                // Link to the failure node's outputs instead of copying them
+                uint32_t f = a.fail[child];
+                arrays.dict_link[child] = a.output[f] != Automaton::NO_PATTERN ? f : a.dict_link[f];
+            }
+        };
+
+        // States are in BFS order and edge e leads to state e + 1, so the
+        // children of the level [begin, end) are the next level
+        // [end, edge_begin[end] + 1). Failure targets are strictly
+        // shallower, so a level can be linked in parallel once the levels
+        // above it are done.
+        uint32_t begin = Automaton::ROOT;
+        uint32_t end = Automaton::ROOT + 1;
+        while (begin < end) {
+            const size_t level = end - begin;
+            if (pool != nullptr && level >= 2 * LINK_CHUNK) {
+                for_each_index(pool, (level + LINK_CHUNK - 1) / LINK_CHUNK, [&](size_t chunk) {
+                    uint32_t first = begin + static_cast<uint32_t>(chunk * LINK_CHUNK);
+                    uint32_t last = std::min(end, first + LINK_CHUNK);
+                    for (uint32_t state = first; state < last; state++) link_children(state);
+                });
+            } else {
+                for (uint32_t state = begin; state < end; state++) link_children(state);
+            }
+            begin = end;
+            end = a.edge_begin[end] + 1;
+        }
+    }
+
+    // Merges states that no text can tell apart: states where words of the
+    // same length end, whose edges lead to merged states and whose failure
+    // links do too. Shared word endings collapse into one chain, as in a
+    // DAWG. Merged states can't name the word that ended there, so they
+    // store its length and the pattern ID is looked up by the hash of the
+    // matched code points. Returns a unchanged when nothing merges or two
+    // words hash alike.
+    static Automaton minimize_automaton(const Automaton& a, const std::vector<std::u32string>& words) {
+        std::vector<std::pair<uint64_t, uint32_t>> hashes(words.size());
+        for (uint32_t id = 0; id < words.size(); id++) {
+            uint64_t hash = Automaton::HASH_SEED;
+            for (char32_t ch : words[id]) hash = Automaton::hash_step(hash, ch);
+            hashes[id] = {hash, id};
+        }
+        std::sort(hashes.begin(), hashes.end());
+        for (size_t i = 1; i < hashes.size(); i++) {
+            if (hashes[i].first == hashes[i - 1].first) return a;
+        }
 
-        for (const auto& word : forbidden_words) {
-            auto node = root.get();
-            for (char32_t ch : word) {
-                if (!node->children[ch]) {
-                    node->children[ch] = std::make_unique<TrieNode>();
+        // Moore-style partition refinement, starting from the length of the
+        // word ending at each state. The root is never merged: it has no
+        // failure link. Classes are numbered in BFS order of their first
+        // state, so failure targets still come before the states failing to them.
+        const size_t states = a.state_count();
+        auto own_length = [&](uint32_t s) {
+            return a.output[s] == Automaton::NO_PATTERN ? Automaton::NO_PATTERN : a.pattern_length[a.output[s]];
+        };
+        struct SignatureHash {
+            size_t operator()(const std::vector<uint32_t>& v) const {
+                uint64_t hash = Automaton::HASH_SEED;
+                for (uint32_t x : v) hash = Automaton::hash_step(hash, x);
+                return static_cast<size_t>(hash);
+            }
+        };
+        std::unordered_map<std::vector<uint32_t>, uint32_t, SignatureHash> ids;
+        std::vector<uint32_t> signature;
+        std::vector<uint32_t> cls(states, 0);
+        std::vector<uint32_t> refined(states);
+        size_t classes = 0;
+        for (bool first = true;; first = false) {
+            ids.clear();
+            for (uint32_t s = 0; s < states; s++) {
+                if (first) {
+                    signature.assign({own_length(s)});
+                } else {
+                    signature.assign({cls[s], s == Automaton::ROOT ? Automaton::NO_STATE : cls[a.fail[s]]});
+                    for (uint32_t e = a.edge_begin[s]; e < a.edge_begin[s + 1]; e++) {
+                        signature.push_back(a.edge_label[e]);
+                        signature.push_back(cls[a.edge_target[e]]);
+                    }
                 }
-                node = node->children[ch].get();
+                auto it = ids.find(signature);
+                if (it == ids.end()) {
+                    it = ids.emplace(signature, static_cast<uint32_t>(ids.size())).first;
+                }
+                refined[s] = it->second;
+            }
+            bool stable = !first && ids.size() == classes;
+            classes = ids.size();
+            cls.swap(refined);
+            if (stable) break;
+        }
+        if (classes == states) return a;
+
+        std::vector<uint32_t> first_state(classes, Automaton::NO_STATE);
+        size_t edges = 0;
+        for (uint32_t s = 0; s < states; s++) {
+            if (first_state[cls[s]] == Automaton::NO_STATE) {
+                first_state[cls[s]] = s;
+                edges += a.edge_begin[s + 1] - a.edge_begin[s];
+            }
+        }
+
+        auto arrays = std::make_shared<Automaton::Arrays>();
+        arrays->edge_begin.reserve(classes + 1);
+        arrays->edge_label.reserve(edges);
+        arrays->edge_target.reserve(edges);
+        arrays->fail.reserve(classes);
+        arrays->output.reserve(classes);
+        arrays->dict_link.reserve(classes);
+        for (uint32_t c = 0; c < classes; c++) {
+            const uint32_t s = first_state[c];
+            arrays->edge_begin.push_back(static_cast<uint32_t>(arrays->edge_label.size()));
+            for (uint32_t e = a.edge_begin[s]; e < a.edge_begin[s + 1]; e++) {
+                arrays->edge_label.push_back(a.edge_label[e]);
+                arrays->edge_target.push_back(cls[a.edge_target[e]]);
+            }
+            arrays->fail.push_back(s == Automaton::ROOT ? Automaton::ROOT : cls[a.fail[s]]);
+            arrays->output.push_back(own_length(s));
+            arrays->dict_link.push_back(a.dict_link[s] == Automaton::NO_STATE ? Automaton::NO_STATE : cls[a.dict_link[s]]);
+        }
+        arrays->edge_begin.push_back(static_cast<uint32_t>(arrays->edge_label.size()));
+        arrays->pattern_length.assign(a.pattern_length.begin(), a.pattern_length.end());
+        arrays->word_offset.assign(a.word_offset.begin(), a.word_offset.end());
+        arrays->word_text.assign(a.word_text.begin(), a.word_text.end());
+        arrays->word_hash.reserve(hashes.size());
+        arrays->word_hash_id.reserve(hashes.size());
+        for (const auto& [hash, id] : hashes) {
+            arrays->word_hash.push_back(hash);
+            arrays->word_hash_id.push_back(id);
+        }
+
+        Automaton minimized;
+        minimized.attach(arrays);
+        minimized.max_pattern_length = a.max_pattern_length;
+        minimized.window_size = a.window_size;
+        minimized.trie_states = states;
+        minimized.trie_bytes = a.table_bytes();
+        return minimized;
+    }
+
+    static bool is_compiled_file(const std::string& path) {
+        char magic[sizeof(COMPILED_MAGIC)] = {};
+        std::ifstream file(path, std::ios::binary);
+        file.read(magic, sizeof(magic));
+        return file.gcount() == sizeof(magic) && std::memcmp(magic, COMPILED_MAGIC, sizeof(magic)) == 0;
+    }
+
+    // Why the entries of a mapped automaton cannot be scanned safely, or
+    // nullptr. Every index has to land inside its table and every chain has
+    // to end, since the scan loops use them unchecked: edge ranges ascend,
+    // edge targets are states, failure and dictionary links point to earlier
+    // states (BFS order, so following them terminates), outputs are pattern
+    // IDs (lengths in a minimized automaton), word offsets ascend and the
+    // longest pattern is exactly max_pattern_length. One pass,
+    // O(states + edges + patterns).
+    static const char* invalid_table_entry(const Automaton& a, size_t max_pattern_length) {
+        const size_t states = a.state_count();
+        const size_t patterns = a.pattern_count();
+        const bool lengths = a.minimized();
+        if (a.edge_begin[0] != 0 || a.fail[Automaton::ROOT] != Automaton::ROOT) return "bad root state";
+        for (uint32_t s = 0; s < states; s++) {
+            uint32_t begin = a.edge_begin[s];
+            uint32_t end = a.edge_begin[s + 1];
+            if (end < begin) return "edge ranges out of order";
+            for (uint32_t e = begin; e < end; e++) {
+                if (a.edge_target[e] >= states) return "edge target out of range";
+                if (e > begin && a.edge_label[e] <= a.edge_label[e - 1]) return "edge labels out of order";
+            }
+            if (s != Automaton::ROOT && a.fail[s] >= s) return "failure link out of range";
+            uint32_t link = a.dict_link[s];
+            if (link != Automaton::NO_STATE && (link >= s || a.output[link] == Automaton::NO_PATTERN)) {
+                return "dictionary link out of range";
             }
-            node->output.push_back(word);
+            uint32_t out = a.output[s];
+            if (out != Automaton::NO_PATTERN && (lengths ? out == 0 || out > max_pattern_length : out >= patterns)) {
+                return "output out of range";
+            }
+        }
+        size_t longest = 0;
+        for (size_t p = 0; p < patterns; p++) {
+            if (a.pattern_length[p] == 0 || a.pattern_length[p] > max_pattern_length) return "pattern length out of range";
+            if (a.word_offset[p + 1] < a.word_offset[p]) return "word offsets out of order";
+            longest = std::max<size_t>(longest, a.pattern_length[p]);
         }
+        if (longest != max_pattern_length) return "maximum pattern length does not match the patterns";
+        for (size_t i = 0; i < a.word_hash.size(); i++) {
+            if (a.word_hash_id[i] >= patterns) return "word hash ID out of range";
+            if (i > 0 && a.word_hash[i] <= a.word_hash[i - 1]) return "word hashes out of order";
+        }
+        return nullptr;
     }
 
-    void build_failure_links() {
-        std::queue<TrieNode*> q;
+    // Point automaton_ at the tables of a compiled dictionary file. Only the
+    // header is copied; the tables are checked in place by one pass of
+    // invalid_table_entry() and stay mapped, shared between processes.
+    void load_compiled(const std::string& path) {
+        auto file = std::make_shared<const MappedFile>(path);
+        auto fail = [&](const std::string& reason) {
+            return std::runtime_error("Invalid compiled dictionary " + path + ": " + reason);
+        };
+
+        CompiledHeader header;
+        if (file->size() < sizeof(header)) {
+            throw fail("file is truncated");
+        }
+        std::memcpy(&header, file->data(), sizeof(header));
+        if (std::memcmp(header.magic, COMPILED_MAGIC, sizeof(COMPILED_MAGIC)) != 0) {
+            throw fail("bad magic");
+        }
+        if (header.version != COMPILED_VERSION) {
+            throw fail("unsupported format version " + std::to_string(header.version));
+        }
+        if (header.byte_order != COMPILED_BYTE_ORDER) {
+            throw fail("compiled on a machine with a different byte order");
+        }
+        if (std::string_view(header.unicode_version, strnlen(header.unicode_version, sizeof(header.unicode_version))) !=
+            forword_fold::UNICODE_VERSION) {
+            throw fail("compiled with a different Unicode folding table");
+        }
 
-        // Set failure links for depth 1 nodes
-        for (auto& pair : root->children) {
-            pair.second->fail = root.get();
-            q.push(pair.second.get());
+        Automaton a;
+        size_t index = 0;
+        bool in_bounds = true;
+        Automaton::for_each_table(a, [&](auto& table) {
+            using T = std::remove_const_t<std::remove_pointer_t<decltype(table.data)>>;
+            uint64_t offset = header.tables[index][0];
+            uint64_t count = header.tables[index][1];
+            index++;
+            if (offset % alignof(T) != 0 || offset > file->size() || count > (file->size() - offset) / sizeof(T)) {
+                in_bounds = false;
+                return;
+            }
+            table.data = reinterpret_cast<const T*>(file->data() + offset);
+            table.count = static_cast<size_t>(count);
+        });
+        if (!in_bounds) {
+            throw fail("table out of bounds");
         }
 
-        // Build failure links for deeper nodes
-        while (!q.empty()) {
-            auto current = q.front();
-            q.pop();
+        const size_t states = a.fail.size();
+        const size_t patterns = a.pattern_length.size();
+        bool consistent = states > 0 && a.edge_begin.size() == states + 1 && a.output.size() == states &&
+                          a.dict_link.size() == states && a.edge_label.size() == a.edge_target.size() &&
+                          a.edge_begin[states] == a.edge_label.size() && a.word_offset.size() == patterns + 1 &&
+                          a.word_offset[patterns] <= a.word_text.size() && a.word_hash.size() == a.word_hash_id.size() &&
+                          (a.word_hash.size() == 0 || a.word_hash.size() == patterns);
+        if (!consistent) {
+            throw fail("inconsistent table sizes");
+        }
+        // The scan buffers are sized by window_size, so it has to be the one
+        // the builder derives from max_pattern_length, which is checked below
+        uint64_t window_size = 1;
+        while (window_size < header.max_pattern_length && window_size < (uint64_t(1) << 62)) {
+            window_size <<= 1;
+        }
+        if (header.window_size != window_size || header.max_pattern_length > window_size) {
+            throw fail("window size does not match the maximum pattern length");
+        }
+        if (const char* reason = invalid_table_entry(a, static_cast<size_t>(header.max_pattern_length))) {
+            throw fail(reason);
+        }
+        a.max_pattern_length = static_cast<size_t>(header.max_pattern_length);
+        a.window_size = static_cast<size_t>(header.window_size);
+        a.trie_states = static_cast<size_t>(header.trie_states);
+        a.trie_bytes = static_cast<size_t>(header.trie_bytes);
+        a.storage = std::move(file);
+        a.mapped = true;
+        automaton_ = std::move(a);
+    }
 
-            for (auto& pair : current->children) {
-                auto child = pair.second.get();
-                q.push(child);
-                
-                auto failure = current->fail;
-                while (failure && !failure->children.count(pair.first)) {
-                    failure = failure->fail;
-                }
+    // Called whenever the set of pattern IDs changes.
+    void update_pattern_window() {
+        max_pattern_length_ = std::max(automaton_.max_pattern_length, delta_.max_pattern_length);
+        window_size_ = std::max(automaton_.window_size, delta_.window_size);
+        build_prefilter();
+        FORWORD_STATS(stats_.resize_patterns(word_count());)
+    }
 
-                child->fail = failure ? failure->children[pair.first].get() : root.get();
-                
-                // Add outputs from failure node
-                if (child->fail->output.size() > 0) {
-                    child->output.insert(
-                        child->output.end(),
-                        child->fail->output.begin(),
-                        child->fail->output.end()
-                    );
-                }
-            }
+    // Pattern ID of a normalized word in the main automaton, or NO_PATTERN.
+    uint32_t find_main_pattern(const std::u32string& word) const {
+        uint32_t state = Automaton::ROOT;
+        for (char32_t ch : word) {
+            state = automaton_.child(state, ch);
+            if (state == Automaton::NO_STATE) return Automaton::NO_PATTERN;
+        }
+        if (automaton_.output[state] == Automaton::NO_PATTERN || !automaton_.minimized()) {
+            return automaton_.output[state];
         }
+        uint64_t hash = Automaton::HASH_SEED;
+        for (char32_t ch : word) hash = Automaton::hash_step(hash, ch);
+        return automaton_.find_word(hash);
+    }
+
+    void rebuild_delta() {
+        delta_ = delta_words_.empty() ? Automaton() : build_automaton(delta_words_, delta_originals_);
+        update_pattern_window();
+        dictionary_changed();
     }
 
     bool is_word_char(char32_t ch) const {
         // Basic Latin letters and numbers
-        if (std::isalnum(ch)) return true;
+        if (ch < 0x80 && std::isalnum(static_cast<int>(ch))) return true;
         
         // Latin-1 Supplement letters (e.g., accented letters like á, é, etc.)
         if (ch >= 0x00C0 && ch <= 0x00FF) return true;
@@ -327,201 +2639,1030 @@ private:
         return false;
     }
 
-    bool is_space_char(char32_t ch) const {
+    static bool is_space_char(char32_t ch) {
         return ch == U' ' || ch == U'\t' || ch == U'\n' || ch == U'\r';
     }
 
-    std::u32string normalize_text(const std::u32string& text) const {
-        std::u32string result;
-        result.reserve(text.size());
-        
-        for (char32_t ch : text) {
-            // Convert to lowercase first
-            if (ch >= U'A' && ch <= U'Z') {
-                ch = ch - U'A' + U'a';
-            }
-            
-            // Skip combining diacritical marks (0300-036F)
-            if (ch >= 0x0300 && ch <= 0x036F) {
-                continue;
+public:
+    explicit Forword(
+        const std::string& forbidden_words_file,
+        IgnoredSymbols ignored_symbols = DEFAULT_IGNORED_SYMBOLS
+    ) : Forword(forbidden_words_file, std::move(ignored_symbols), Options()) {}
+
+    Forword(
+        const std::string& forbidden_words_file,
+        IgnoredSymbols ignored_symbols,
+        Options options
+    ) : ignored_symbols_(std::move(ignored_symbols)), options_(options), cache_(options.result_cache_entries) {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Build);)
+        init_ignored_tables();
+        // A dictionary compiled with save_compiled() is mapped as is
+        if (is_compiled_file(forbidden_words_file)) {
+            load_compiled(forbidden_words_file);
+            build_dense_dfa();
+            update_pattern_window();
+            return;
+        }
+
+        MappedFile file(forbidden_words_file, "forbidden words file", MappedFile::Access::Read);
+        std::string transcoded;
+        std::vector<std::string_view> lines = read_word_lines(std::string_view(file.data(), file.size()), transcoded);
+        std::unique_ptr<ThreadPool> pool = make_build_pool(lines.size());
+
+        std::vector<std::string> originals;
+        std::vector<std::u32string> words = normalize_word_lines(lines, originals, pool.get());
+        automaton_ = build_automaton(words, originals, pool.get());
+        if (options_.minimize) {
+            automaton_ = minimize_automaton(automaton_, words);
+        }
+        build_dense_dfa();
+        update_pattern_window();
+    }
+
+    // Writes the finished automaton to path as a compiled dictionary, which
+    // the constructor maps read-only instead of parsing the word list again.
+    // The file is tied to this format version, byte order and folding table.
+    void save_compiled(const std::string& path) const {
+        if (has_delta() || removed_count_ > 0) {
+            Forword merged(*this);
+            merged.compact();
+            merged.save_compiled(path);
+            return;
+        }
+
+        CompiledHeader header{};
+        std::memcpy(header.magic, COMPILED_MAGIC, sizeof(COMPILED_MAGIC));
+        header.version = COMPILED_VERSION;
+        header.byte_order = COMPILED_BYTE_ORDER;
+        std::strncpy(header.unicode_version, forword_fold::UNICODE_VERSION, sizeof(header.unicode_version) - 1);
+        header.max_pattern_length = automaton_.max_pattern_length;
+        header.window_size = automaton_.window_size;
+        header.trie_states = automaton_.trie_states;
+        header.trie_bytes = automaton_.trie_bytes;
+
+        auto align = [](uint64_t offset) { return (offset + 7) & ~uint64_t(7); };
+        uint64_t offset = align(sizeof(header));
+        size_t index = 0;
+        Automaton::for_each_table(automaton_, [&](const auto& table) {
+            header.tables[index][0] = offset;
+            header.tables[index][1] = table.size();
+            offset = align(offset + table.size() * sizeof(*table.data));
+            index++;
+        });
+
+        // Written next to path and renamed over it, so a process that still
+        // maps the old file keeps reading intact pages
+#if !defined(_WIN32)
+        const std::string temp_path = path + ".tmp" + std::to_string(::getpid());
+#else
+        const std::string temp_path = path + ".tmp";
+#endif
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to create compiled dictionary: " + path);
+        }
+        const char padding[8] = {};
+        uint64_t written = sizeof(header);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        index = 0;
+        Automaton::for_each_table(automaton_, [&](const auto& table) {
+            file.write(padding, header.tables[index][0] - written);
+            file.write(reinterpret_cast<const char*>(table.data), table.size() * sizeof(*table.data));
+            written = header.tables[index][0] + table.size() * sizeof(*table.data);
+            index++;
+        });
+        file.close();
+        if (!file || !sync_file(temp_path)) {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Failed to write compiled dictionary: " + path);
+        }
+#if defined(_WIN32)
+        std::remove(path.c_str());
+#endif
+        if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Failed to replace compiled dictionary: " + path);
+        }
+    }
+
+    bool search(std::string_view text) const {
+        if (text.empty()) return false;
+        if (!cache_.enabled() || text.size() > RESULT_CACHE_MAX_TEXT) return search_text(text);
+
+        bool found;
+        if (!cache_.find_verdict(text, found)) {
+            found = search_text(text);
+            cache_.store_verdict(text, found);
+        }
+        return found;
+    }
+
+    std::string replace(std::string_view text, std::string_view replacement = "***") const {
+        std::string result;
+        if (text.empty()) {
+            return result;
+        }
+        const bool cached = cache_.enabled() && text.size() <= RESULT_CACHE_MAX_TEXT;
+        if (cached && cache_.find_replaced(text, replacement, result)) {
+            return result;
+        }
+        result.reserve(text.size() + replacement.size() + 2);
+        with_thread_scratch([&](Scratch& scratch) { replace_text(text, replacement, result, scratch); });
+        if (cached) {
+            cache_.store_replaced(text, replacement, result);
+        }
+        return result;
+    }
+
+    // Buffers for scans that can be reused across calls. The calls without
+    // a Workspace use one kept per thread.
+    class Workspace {
+    private:
+        friend class Forword;
+        Scratch scratch_;
+    };
+
+    // replace() into a caller-owned string, whose previous contents are
+    // discarded. Once out and the workspace have grown to fit the messages
+    // seen, further calls don't allocate.
+    void replace_into(std::string_view text, std::string& out, std::string_view replacement = "***") const {
+        with_thread_scratch([&](Scratch& scratch) { replace_with(text, out, replacement, scratch); });
+    }
+
+    void replace_into(std::string_view text, std::string& out, std::string_view replacement,
+                      Workspace& workspace) const {
+        replace_with(text, out, replacement, workspace.scratch_);
+    }
+
+    // A forbidden word found in a message: the original bytes [begin, end)
+    // and the ID of the dictionary word that matched (see word()).
+    struct Match {
+        size_t begin;
+        size_t end;
+        uint32_t pattern_id;
+    };
+
+    // Calls on_match(const Match&) for every occurrence, overlapping ones
+    // included, in order of end position. If on_match returns bool, returning
+    // false stops the scan early. Returns false when stopped early.
+    template <typename F>
+    bool find_all(std::string_view text, F&& on_match) const {
+        return with_thread_scratch([&](Scratch& scratch) { return find_all_with(text, scratch, on_match); });
+    }
+
+    template <typename F>
+    bool find_all(std::string_view text, Workspace& workspace, F&& on_match) const {
+        return find_all_with(text, workspace.scratch_, on_match);
+    }
+
+    std::vector<Match> find_all(std::string_view text) const {
+        std::vector<Match> matches;
+        find_all(text, [&](const Match& m) { matches.push_back(m); });
+        return matches;
+    }
+
+    // Where a conversation (one user or channel) left off, so that a word
+    // split over several messages ("b", "a", "d") is still found: the
+    // automaton positions and the last max_pattern_length - 1 normalized
+    // code points. Keep one per conversation and pass it with each message
+    // to search_continue() or replace_continue(); each message then costs
+    // only its own length. If the dictionary changed in between (add_word(),
+    // compact(), a Reloadable reload), the positions are rebuilt from the
+    // kept code points.
+    class ScanState {
+    public:
+        // Forgets the messages seen so far.
+        void reset() { *this = ScanState(); }
+
+    private:
+        friend class Forword;
+        uint64_t dictionary_{0};  // dictionary_id_ that position_ belongs to
+        ScanPosition position_;   // recent is always null here
+        std::u32string tail_;
+    };
+
+    // search() for the next message of a conversation: whether a word ends
+    // in text, including words that started in earlier messages. Words that
+    // ended in earlier messages are not reported again.
+    bool search_continue(ScanState& state, std::string_view text) const {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Scan);)
+        bool found = false;
+        continue_scan(state, [&](Scratch& scratch, ScanPosition& position) {
+            for_each_match(text, scratch, position, [&](const Span&, uint32_t) {
+                found = true;
+                return true;
+            });
+        });
+        return found;
+    }
+
+    // replace() for the next message of a conversation. A word that started
+    // in an earlier message is replaced from the start of text on, as the
+    // earlier part has already gone out; a word that would only be complete
+    // with the next message is left for that call to find.
+    std::string replace_continue(ScanState& state, std::string_view text, std::string_view replacement = "***") const {
+        std::string result;
+        result.reserve(text.size() + replacement.size() + 2);
+        continue_scan(state, [&](Scratch& scratch, ScanPosition& position) {
+            replace_text(text, replacement, result, scratch, position);
+        });
+        return result;
+    }
+
+    // Dictionary word for a pattern ID, as written in the forbidden words
+    // file or passed to add_word().
+    std::string_view word(uint32_t pattern_id) const {
+        if (pattern_id >= word_count()) {
+            throw std::out_of_range("Forword::word: pattern ID out of range");
+        }
+        if (pattern_id < automaton_.pattern_count()) {
+            return automaton_.word(pattern_id);
+        }
+        return delta_originals_[pattern_id - automaton_.pattern_count()];
+    }
+
+    // Pattern IDs are [0, word_count()). Removed words keep their ID until
+    // compact().
+    size_t word_count() const {
+        return automaton_.pattern_count() + delta_words_.size();
+    }
+
+    // Bytes held by the dictionary. The build reserves every table to its
+    // final size, so the heap figures are exact rather than estimates.
+    struct MemoryUsage {
+        size_t automaton;       // tables of the main automaton
+        size_t delta;           // delta automaton, added words and removal marks
+        size_t prefilter;       // bigram bitset
+        size_t dense_dfa;       // full transition table, 0 when not built
+        size_t states;          // of the main automaton
+        size_t trie_states;     // states and table bytes of the main automaton before
+        size_t trie_automaton;  // Options::minimize; equal to the above when not minimized
+        bool mapped;            // main tables are shared pages of a compiled file
+        size_t total() const { return automaton + delta + prefilter + dense_dfa; }
+    };
+
+    MemoryUsage memory_usage() const {
+        size_t delta = delta_.table_bytes() + (removed_.size() + 7) / 8;
+        for (size_t i = 0; i < delta_words_.size(); i++) {
+            delta += delta_words_[i].size() * sizeof(char32_t) + delta_originals_[i].size();
+        }
+        const bool minimized = automaton_.minimized();
+        return MemoryUsage{automaton_.table_bytes(), delta, prefilter_.bytes(), dense_.bytes(), automaton_.state_count(),
+                           minimized ? automaton_.trie_states : automaton_.state_count(),
+                           minimized ? automaton_.trie_bytes : automaton_.table_bytes(), automaton_.mapped};
+    }
+
+    // Counters and timing histograms collected since construction or the
+    // last reset_stats(). Only recorded when built with FORWORD_ENABLE_STATS;
+    // otherwise enabled is false and everything is zero. Safe to call while
+    // other threads scan.
+    Stats stats() const {
+#if defined(FORWORD_ENABLE_STATS)
+        return stats_.snapshot();
+#else
+        return Stats{};
+#endif
+    }
+
+    void reset_stats() const {
+        FORWORD_STATS(stats_.reset();)
+    }
+
+    // Hit rate and size of the result cache; all zero when it is disabled.
+    // Safe to call while other threads scan.
+    CacheStats cache_stats() const {
+        return cache_.stats();
+    }
+
+    // Adds a word without rebuilding the dictionary. It goes into the delta
+    // automaton, so the cost depends only on the words added since the last
+    // compact(). Returns false if an equivalent word is already present.
+    // Like remove_word() and compact(), this must not run concurrently with
+    // scans of the same object; see Reloadable::update().
+    bool add_word(const std::string& word) {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Build);)
+        std::string line = word;
+        line.erase(0, line.find_first_not_of(" \t\n\r"));
+        line.erase(line.find_last_not_of(" \t\n\r") + 1);
+        std::u32string normalized = normalize_dictionary_word(line);
+        if (normalized.empty()) {
+            return false;
+        }
+
+        uint32_t pattern_id = find_main_pattern(normalized);
+        if (pattern_id != Automaton::NO_PATTERN) {
+            if (removed_count_ == 0 || !removed_[pattern_id]) {
+                return false;
+            }
+            removed_[pattern_id] = false;
+            removed_count_--;
+            dictionary_changed();
+            return true;
+        }
+        if (std::find(delta_words_.begin(), delta_words_.end(), normalized) != delta_words_.end()) {
+            return false;
+        }
+        delta_words_.push_back(std::move(normalized));
+        delta_originals_.push_back(std::move(line));
+        rebuild_delta();
+        return true;
+    }
+
+    // Removes a word, or the word it is equivalent to after normalization.
+    // Words of the main automaton are only marked as removed until compact();
+    // removing an added word renumbers the words added after it.
+    bool remove_word(const std::string& word) {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Build);)
+        std::u32string normalized = normalize_dictionary_word(word);
+        uint32_t pattern_id = find_main_pattern(normalized);
+        if (pattern_id != Automaton::NO_PATTERN) {
+            if (removed_.empty()) {
+                removed_.resize(automaton_.pattern_count());
             }
-            
-            // Convert to UTF-8 to check against ignored_symbols
-            std::string utf8_ch = to_utf8(std::u32string(1, ch));
-            if (!utf8_ch.empty() && 
-                ignored_symbols_.find(utf8_ch[0]) == ignored_symbols_.end()) {
-                result.push_back(ch);
+            if (removed_[pattern_id]) {
+                return false;
             }
+            removed_[pattern_id] = true;
+            removed_count_++;
+            dictionary_changed();
+            return true;
         }
-        
-        return result;
+
+        auto it = std::find(delta_words_.begin(), delta_words_.end(), normalized);
+        if (it == delta_words_.end()) {
+            return false;
+        }
+        delta_originals_.erase(delta_originals_.begin() + (it - delta_words_.begin()));
+        delta_words_.erase(it);
+        rebuild_delta();
+        return true;
     }
 
-public:
-    explicit Forword(
-        const std::string& forbidden_words_file,
-        const std::unordered_set<char>& ignored_symbols = DEFAULT_IGNORED_SYMBOLS
-    ) : ignored_symbols_(ignored_symbols) {
-        std::locale::global(std::locale("")); // Use system locale for correct UTF-8 conversion
-        forbidden_words = load_forbidden_words(forbidden_words_file);
-        build_trie();
-        build_failure_links();
+    // Rebuilds the main automaton with the added words merged in and the
+    // removed ones dropped. Pattern IDs are renumbered.
+    void compact() {
+        FORWORD_STATS(PhaseTimer timer(stats_, Phase::Build);)
+        FORWORD_STATS(stats_.resize_patterns(0);)  // IDs are renumbered
+        std::vector<std::u32string> words;
+        std::vector<std::string> originals;
+        for (uint32_t id = 0; id < automaton_.pattern_count(); id++) {
+            if (removed_count_ > 0 && removed_[id]) continue;
+            std::string_view original = automaton_.word(id);
+            words.push_back(normalize_dictionary_word(original));
+            originals.emplace_back(original);
+        }
+        words.insert(words.end(), delta_words_.begin(), delta_words_.end());
+        originals.insert(originals.end(), delta_originals_.begin(), delta_originals_.end());
+
+        std::unique_ptr<ThreadPool> pool = make_build_pool(words.size());
+        automaton_ = build_automaton(words, originals, pool.get());
+        if (options_.minimize) {
+            automaton_ = minimize_automaton(automaton_, words);
+        }
+        build_dense_dfa();
+        delta_ = Automaton();
+        delta_words_.clear();
+        delta_originals_.clear();
+        removed_.clear();
+        removed_count_ = 0;
+        update_pattern_window();
+        dictionary_changed();
     }
 
-    bool search(const std::string& text) const {
-        if (text.empty()) return false;
+    // Fixed-size pool of worker threads for the batch API. Every worker owns
+    // a task deque; it takes work from the back of its own deque and steals
+    // from the front of the others when it runs dry. The thread calling
+    // parallel_for() takes part as worker 0.
+    class ThreadPool {
+    public:
+        explicit ThreadPool(size_t threads = std::thread::hardware_concurrency())
+            : queues_(std::max<size_t>(threads, 1)) {
+            for (size_t i = 1; i < queues_.size(); i++) {
+                workers_.emplace_back([this, i] { worker_loop(i); });
+            }
+        }
 
-        // Use normalize_utf8_with_mapping to obtain normalized text and mapping vector.
-        auto [normalized_input, mapping] = normalize_utf8_with_mapping(text);
-        auto utf32_text = to_utf32(normalized_input);
-        // Build filtered mapping for normalized_text (filtering out ignored symbols only)
-        std::u32string normalized_text;
-        std::vector<size_t> norm_to_orig;
-        for (size_t i = 0; i < utf32_text.size(); i++) {
-            std::string utf8_ch = to_utf8(std::u32string(1, utf32_text[i]));
-            if (!utf8_ch.empty() && 
-                ignored_symbols_.find(utf8_ch[0]) == ignored_symbols_.end()) {
-                normalized_text.push_back(utf32_text[i]);
-                norm_to_orig.push_back(mapping[i]);
-            }
-        }
-        const TrieNode* current = root.get();
-
-        for (size_t i = 0; i < normalized_text.size(); i++) {
-            char32_t ch = normalized_text[i];
-            while (current != root.get() && !current->children.count(ch)) {
-                current = current->fail;
-            }
-            if (current->children.count(ch)) {
-                current = current->children.at(ch).get();
-                for (const auto& word : current->output) {
-                    std::u32string normalized_word = normalize_text(word);
-                    size_t word_pos = i - normalized_word.length() + 1;
-                    
-                    if (word_pos <= i && 
-                        normalized_text.substr(word_pos, normalized_word.length()) == normalized_word) {
-                        if (word_pos < norm_to_orig.size() && i < norm_to_orig.size()) {
-                            return true;
-                        }
-                    }
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto& worker : workers_) {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t size() const { return queues_.size(); }
+
+        // Runs task(index, worker) for every index in [0, count) and waits for
+        // all of them. worker is in [0, size()) and can be used to pick
+        // per-thread scratch state. The first exception thrown is rethrown.
+        void parallel_for(size_t count, const std::function<void(size_t, size_t)>& task) {
+            if (count == 0) return;
+            std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+            job_ = &task;
+            error_ = nullptr;
+            remaining_.store(count);
+
+            // Contiguous slices keep neighbouring tasks on the same worker
+            for (size_t w = 0; w < queues_.size(); w++) {
+                std::lock_guard<std::mutex> lock(queues_[w].mutex);
+                for (size_t t = count * w / queues_.size(); t < count * (w + 1) / queues_.size(); t++) {
+                    queues_[w].tasks.push_back(t);
                 }
             }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                generation_++;
+            }
+            wake_.notify_all();
+
+            run_tasks(0);
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [&] { return remaining_.load() == 0; });
+            job_ = nullptr;
+            if (error_) {
+                std::rethrow_exception(error_);
+            }
         }
 
-        return false;
-    }
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<size_t> tasks;
+        };
 
-    std::string replace(const std::string& text, const std::string& replacement = "***") const {
-        if (text.empty()) {
-            return text;
-        }
-
-        // Use normalize_utf8_with_mapping to obtain normalized text and mapping vector.
-        auto [normalized_input, mapping] = normalize_utf8_with_mapping(text);
-        auto utf32_text = to_utf32(normalized_input);
-        // Build filtered mapping for normalized_text (only filtering out ignored symbols)
-        std::u32string normalized_text;
-        std::vector<size_t> norm_to_orig;
-        for (size_t i = 0; i < utf32_text.size(); i++) {
-            std::string utf8_ch = to_utf8(std::u32string(1, utf32_text[i]));
-            if (!utf8_ch.empty() && 
-                ignored_symbols_.find(utf8_ch[0]) == ignored_symbols_.end()) {
-                normalized_text.push_back(utf32_text[i]);
-                norm_to_orig.push_back(mapping[i]);
-            }
-        }
-        auto original_utf32 = to_utf32(text);  // Original text (unchanged)
-        const TrieNode* current = root.get();
-        std::set<std::pair<size_t, size_t>> matches;
-        size_t pos = 0;
-
-        // Find all matches
-        while (pos < normalized_text.length()) {
-            char32_t ch = normalized_text[pos];
-            
-            while (current != root.get() && !current->children.count(ch)) {
-                current = current->fail;
-            }
-            
-            if (current->children.count(ch)) {
-                current = current->children.at(ch).get();
-                
-                for (const auto& word : current->output) {
-                    std::u32string normalized_word = normalize_text(word);
-                    size_t word_pos = pos - normalized_word.length() + 1;
-                    
-                    if (word_pos <= pos &&
-                        normalized_text.substr(word_pos, normalized_word.length()) == normalized_word) {
-                        if (word_pos < norm_to_orig.size() && pos < norm_to_orig.size()) {
-                            size_t orig_start = norm_to_orig[word_pos];
-                            size_t orig_end = norm_to_orig[pos];
-
-                            // Extend boundaries to include adjacent spaces
-                            while (orig_start > 0 && is_space_char(original_utf32[orig_start - 1])) {
-                                orig_start--;
-                            }
-                            while (orig_end < original_utf32.length() - 1 && is_space_char(original_utf32[orig_end + 1])) {
-                                orig_end++;
-                            }
-
-                            matches.insert({orig_start, orig_end + 1});
-                        }
-                    }
+        void worker_loop(size_t self) {
+            uint64_t seen = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                    if (stop_) return;
+                    seen = generation_;
                 }
+                run_tasks(self);
             }
-            pos++;
         }
 
-        // Filter overlapping matches: remove any match that is completely contained
-        // in another match with greater length.
-        std::vector<std::pair<size_t, size_t>> filtered;
-        for (const auto& m : matches) {
-            bool contained = false;
-            for (const auto& n : matches) {
-                if (m != n && n.first <= m.first && n.second >= m.second &&
-                    ((n.second - n.first) > (m.second - m.first))) {
-                    contained = true;
-                    break;
+        void run_tasks(size_t self) {
+            size_t task;
+            while (pop_or_steal(self, task)) {
+                try {
+                    (*job_)(task, self);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!error_) error_ = std::current_exception();
+                }
+                if (remaining_.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    done_.notify_all();
                 }
             }
-            if (!contained)
-                filtered.push_back(m);
         }
 
-        // Sort filtered intervals in descending order of start index to safely replace from end to start.
-        std::sort(filtered.begin(), filtered.end(), [](auto a, auto b) { return a.first > b.first; });
-        
-        // Replace filtered matches from end to start.
-        for (const auto& m : filtered) {
-            size_t start = m.first;
-            size_t end = m.second;
-            
-            std::u32string prefix = original_utf32.substr(0, start);
-            std::u32string suffix = end < original_utf32.length() ? original_utf32.substr(end) : U"";
-            
-            // Ensure single space before and after replacement
-            if (!prefix.empty() && !is_space_char(prefix.back())) {
-                prefix += U" ";
+        bool pop_or_steal(size_t self, size_t& task) {
+            {
+                Queue& own = queues_[self];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks.empty()) {
+                    task = own.tasks.back();
+                    own.tasks.pop_back();
+                    return true;
+                }
+            }
+            for (size_t k = 1; k < queues_.size(); k++) {
+                Queue& victim = queues_[(self + k) % queues_.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty()) {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return true;
+                }
             }
-            if (!suffix.empty() && !is_space_char(suffix.front())) {
-                suffix = U" " + suffix;
+            return false;
+        }
+
+        std::vector<Queue> queues_;
+        std::vector<std::thread> workers_;
+        std::mutex run_mutex_;                 // one parallel_for at a time
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        uint64_t generation_{0};
+        bool stop_{false};
+        const std::function<void(size_t, size_t)>* job_{nullptr};
+        std::atomic<size_t> remaining_{0};
+        std::exception_ptr error_;
+    };
+
+    // Batch sizes: small messages are grouped into tasks of about
+    // BATCH_GROUP_BYTES, and messages over BATCH_SPLIT_BYTES are scanned as
+    // several pieces in parallel.
+    static constexpr size_t BATCH_GROUP_BYTES = 64 * 1024;
+    static constexpr size_t BATCH_SPLIT_BYTES = 1024 * 1024;
+
+    // search() over many messages on pool. texts is any indexable container
+    // of strings or string_views; result[i] is the verdict for texts[i].
+    template <typename Texts>
+    std::vector<bool> search_batch(const Texts& texts, ThreadPool& pool) const {
+        const std::vector<BatchTask> tasks = plan_batch(texts);
+        std::vector<std::atomic<bool>> found(std::size(texts));
+
+        pool.parallel_for(tasks.size(), [&](size_t t, size_t) {
+            const BatchTask& task = tasks[t];
+            if (task.piece) {
+                std::string_view text(texts[task.first]);
+                if (found[task.first].load(std::memory_order_relaxed)) return;
+                size_t start = warmup_start(text, task.begin);
+                if (search_text(text.substr(start, task.end - start))) {
+                    found[task.first].store(true, std::memory_order_relaxed);
+                }
+                return;
+            }
+            for (size_t i = task.first; i < task.last; i++) {
+                found[i].store(search_text(texts[i]), std::memory_order_relaxed);
+            }
+        });
+
+        std::vector<bool> result(found.size());
+        for (size_t i = 0; i < found.size(); i++) {
+            result[i] = found[i].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    // replace() over many messages on pool; result[i] is texts[i] replaced.
+    template <typename Texts>
+    std::vector<std::string> replace_batch(const Texts& texts, ThreadPool& pool,
+                                           std::string_view replacement = "***") const {
+        const std::vector<BatchTask> tasks = plan_batch(texts);
+        std::vector<std::string> result(std::size(texts));
+        std::vector<Scratch> scratch(pool.size());
+        std::vector<std::vector<Span>> piece_spans(tasks.size());
+        std::vector<size_t> piece_length(tasks.size());
+
+        pool.parallel_for(tasks.size(), [&](size_t t, size_t worker) {
+            const BatchTask& task = tasks[t];
+            if (task.piece) {
+                piece_length[t] = collect_piece_spans(texts[task.first], task, piece_spans[t], scratch[worker]);
+                return;
+            }
+            for (size_t i = task.first; i < task.last; i++) {
+                std::string_view text(texts[i]);
+                result[i].reserve(text.size() + replacement.size() + 2);
+                replace_text(text, replacement, result[i], scratch[worker]);
             }
-            
-            original_utf32 = prefix + to_utf32(replacement) + suffix;
+        });
+
+        // Resolve the pieces of each split message together and write it out
+        std::vector<size_t> split_tasks;
+        for (size_t t = 0; t < tasks.size(); t++) {
+            if (tasks[t].piece && tasks[t].begin == 0) split_tasks.push_back(t);
         }
+        pool.parallel_for(split_tasks.size(), [&](size_t k, size_t worker) {
+            size_t first_task = split_tasks[k];
+            size_t i = tasks[first_task].first;
+            std::string_view text(texts[i]);
+
+            result[i].reserve(text.size() + replacement.size() + 2);
+            ReplaceWriter writer(text, replacement);
+            MatchResolver resolver(scratch[worker].pending, window_size_);
+            size_t offset = 0;
+            for (size_t t = first_task; t < tasks.size() && tasks[t].piece && tasks[t].first == i; t++) {
+                for (const Span& m : piece_spans[t]) {
+                    resolver.add({m.norm_begin + offset, m.norm_end + offset, m.byte_begin, m.byte_end});
+                }
+                offset += piece_length[t];
+            }
+            resolver.flush([&](const Span& m) { writer.write(m, result[i]); });
+            writer.finish(result[i]);
+        });
 
-        return to_utf8(original_utf32);
+        return result;
     }
 
-    // Wrapper for normalize_utf8_with_mapping that returns only the normalized UTF-8 string.
+    // Scans a stream that arrives in chunks, such as a large upload or a log
+    // archive, without holding it in memory. The automaton state, a UTF-8
+    // sequence cut off at the end of a chunk and the matches still waiting
+    // for leftmost-longest resolution carry over between feed() calls, so
+    // words split across chunks are found and replaced exactly as replace()
+    // would on the whole text. Only bytes a later match could still cover are
+    // buffered: the last max_pattern_length code points plus the spaces and
+    // ignored symbols between them. The Forword object must outlive the scanner.
+    //
+    //     Forword::Scanner scanner(forword, "***");
+    //     while (read(chunk)) { out.clear(); scanner.feed(chunk, out); write(out); }
+    //     out.clear(); scanner.finish(out); write(out);
+    class Scanner {
+    public:
+        // Detects matches only; use feed(chunk) and on_match().
+        explicit Scanner(const Forword& forword)
+            : forword_(forword), output_(false), resolver_(ring_, forword.window_size_),
+              writer_(replacement_) {
+            starts_.resize(forword.window_size_);
+            forword.keep_recent(state_, recent_);
+        }
+
+        // Also writes the stream with matches replaced; use feed(chunk, out).
+        Scanner(const Forword& forword, std::string replacement)
+            : forword_(forword), replacement_(std::move(replacement)), output_(true),
+              resolver_(ring_, forword.window_size_), writer_(replacement_) {
+            starts_.resize(forword.window_size_);
+            forword.keep_recent(state_, recent_);
+        }
+
+        Scanner(const Scanner&) = delete;
+        Scanner& operator=(const Scanner&) = delete;
+
+        // Called for every occurrence, overlapping ones included, with byte
+        // offsets counted from the start of the stream.
+        void on_match(std::function<void(const Match&)> callback) {
+            on_match_ = std::move(callback);
+        }
+
+        void feed(std::string_view chunk) {
+            require_output(false);
+            FORWORD_STATS(PhaseTimer timer(forword_.stats_, Phase::Scan);)
+            scan(chunk, nullptr);
+        }
+
+        // Appends the replaced output that later chunks can no longer change.
+        void feed(std::string_view chunk, std::string& out) {
+            require_output(true);
+            FORWORD_STATS(PhaseTimer timer(forword_.stats_, Phase::Scan);)
+            buffer_.append(chunk);
+            writer_.input(buffer_, buffer_base_);
+            scan(chunk, &out);
+            release(out);
+        }
+
+        // Ends the stream. Call once, after the last feed().
+        void finish() {
+            require_output(false);
+            scan_partial(nullptr);
+        }
+
+        // Ends the stream and appends the rest of the replaced output.
+        void finish(std::string& out) {
+            require_output(true);
+            scan_partial(&out);
+            resolver_.flush([&](const Span& m) { writer_.write(m, out); });
+            writer_.finish(out);
+            buffer_.clear();
+            buffer_base_ = fed_;
+            writer_.input(buffer_, buffer_base_);
+        }
+
+        // Whether any forbidden word was seen so far.
+        bool found() const {
+            return found_;
+        }
+
+    private:
+        static size_t sequence_length(unsigned char lead) {
+            if ((lead & 0xE0) == 0xC0) return 2;
+            if ((lead & 0xF0) == 0xE0) return 3;
+            if ((lead & 0xF8) == 0xF0) return 4;
+            return 1;
+        }
+
+        // Length of a UTF-8 sequence left incomplete at the end of chunk.
+        static size_t incomplete_tail(std::string_view chunk) {
+            for (size_t k = 1; k <= 3 && k <= chunk.size(); k++) {
+                unsigned char c = static_cast<unsigned char>(chunk[chunk.size() - k]);
+                if ((c & 0xC0) != 0x80) {
+                    return sequence_length(c) > k ? k : 0;
+                }
+            }
+            return 0;
+        }
+
+        void require_output(bool output) const {
+            if (output != output_) {
+                throw std::logic_error(output ? "Scanner was created without a replacement"
+                                              : "Scanner with a replacement needs an output string");
+            }
+        }
+
+        void scan(std::string_view chunk, std::string* out) {
+            FORWORD_STATS(struct Flush {
+                ScanPosition& state;
+                const Forword& forword;
+                ~Flush() {
+                    forword.stats_.add_failures(state.failures);
+                    state.failures = 0;
+                }
+            } flush{state_, forword_};)
+            size_t base = fed_;
+            fed_ += chunk.size();
+
+            // Complete the sequence cut off by the previous chunk. Decoding
+            // stops at the first byte that can't continue it, as it would
+            // on the whole text.
+            if (!partial_.empty()) {
+                size_t length = sequence_length(static_cast<unsigned char>(partial_[0]));
+                size_t take = 0;
+                while (partial_.size() + take < length && take < chunk.size() &&
+                       (static_cast<unsigned char>(chunk[take]) & 0xC0) == 0x80) {
+                    take++;
+                }
+                partial_.append(chunk.substr(0, take));
+                chunk.remove_prefix(take);
+                base += take;
+                if (partial_.size() < length && chunk.empty()) {
+                    return;
+                }
+                scan_partial(out);
+            }
+
+            size_t tail = incomplete_tail(chunk);
+            scan_bytes(chunk.substr(0, chunk.size() - tail), base, out);
+            partial_.assign(chunk.substr(chunk.size() - tail));
+            partial_base_ = base + chunk.size() - tail;
+        }
+
+        void scan_partial(std::string* out) {
+            if (!partial_.empty()) {
+                scan_bytes(partial_, partial_base_, out);
+                partial_.clear();
+            }
+        }
+
+        void scan_bytes(std::string_view bytes, size_t base, std::string* out) {
+            const size_t mask = forword_.window_size_ - 1;
+            forword_.for_each_normalized(bytes, [&](char32_t ch, size_t begin, size_t end) {
+                starts_[norm_pos_ & mask] = base + begin;
+                if (forword_.advance(state_, ch) && forword_.has_output(state_)) {
+                    found_ = true;
+                    forword_.for_each_output(state_, [&](uint32_t pattern_id, uint32_t length) {
+                        size_t norm_begin = norm_pos_ + 1 - length;
+                        Span m{norm_begin, norm_pos_, starts_[norm_begin & mask], base + end};
+                        FORWORD_STATS(forword_.stats_.add_match(pattern_id);)
+                        if (on_match_) {
+                            on_match_(Match{m.byte_begin, m.byte_end, pattern_id});
+                        }
+                        if (out) {
+                            resolver_.commit(m.norm_end, forword_.max_pattern_length_,
+                                             [&](const Span& s) { writer_.write(s, *out); });
+                            resolver_.add(m);
+                        }
+                    });
+                }
+                norm_pos_++;
+                return true;
+            });
+        }
+
+        // Write out everything before the earliest byte a later match could
+        // start at, keeping back the spaces it would swallow.
+        void release(std::string& out) {
+            const size_t max_length = forword_.max_pattern_length_;
+            resolver_.commit(norm_pos_, max_length, [&](const Span& s) { writer_.write(s, out); });
+
+            // Pending candidates start no earlier than this either
+            size_t safe = partial_.empty() ? fed_ : partial_base_;
+            size_t first = norm_pos_ + 1 > max_length ? norm_pos_ + 1 - max_length : 0;
+            if (first < norm_pos_) {
+                safe = std::min(safe, starts_[first & (forword_.window_size_ - 1)]);
+            }
+            while (safe > writer_.copied() && is_space_char(buffer_[safe - 1 - buffer_base_])) {
+                safe--;
+            }
+            if (safe > writer_.copied()) {
+                writer_.copy_until(safe, out);
+            }
+
+            buffer_.erase(0, writer_.copied() - buffer_base_);
+            buffer_base_ = writer_.copied();
+            writer_.input(buffer_, buffer_base_);
+        }
+
+        const Forword& forword_;
+        std::string replacement_;
+        bool output_;
+        std::function<void(const Match&)> on_match_;
+
+        ScanPosition state_;
+        size_t norm_pos_{0};
+        bool found_{false};
+        std::vector<size_t> starts_;
+        std::vector<char32_t> recent_;
+        std::vector<Span> ring_;
+        MatchResolver resolver_;
+        ReplaceWriter writer_;
+
+        size_t fed_{0};           // bytes received so far
+        std::string partial_;     // incomplete UTF-8 sequence at the end of the last chunk
+        size_t partial_base_{0};
+        std::string buffer_;      // bytes from buffer_base_ on that aren't written yet
+        size_t buffer_base_{0};
+    };
+
+    // Handle to a dictionary that can be reloaded while other threads scan
+    // with it. Each reload builds a complete new Forword off the read path
+    // and publishes it with one atomic pointer swap. Calls already running
+    // finish on the snapshot they started with. Readers take no locks: they
+    // bump a per-thread-slot counter for the parity of the current epoch.
+    // After a swap the writer flips the epoch twice and waits for each
+    // parity to drain before freeing the old snapshot (SRCU style), so new
+    // readers never hold up a reload. The handle must outlive its readers
+    // and any pending reload_async(). A compiled dictionary stays mapped by
+    // its snapshot, so update it by writing a new file and renaming it over
+    // the old one; word lists are read into memory and may be saved in place.
+    class Reloadable {
+    public:
+        explicit Reloadable(
+            std::string forbidden_words_file,
+            IgnoredSymbols ignored_symbols = DEFAULT_IGNORED_SYMBOLS
+        ) : Reloadable(std::move(forbidden_words_file), std::move(ignored_symbols), Options()) {}
+
+        Reloadable(
+            std::string forbidden_words_file,
+            IgnoredSymbols ignored_symbols,
+            Options options
+        ) : file_(std::move(forbidden_words_file)), ignored_symbols_(std::move(ignored_symbols)), options_(options) {
+            current_.store(new Snapshot{std::make_shared<const Forword>(file_, ignored_symbols_, options_), 0});
+        }
+
+        ~Reloadable() {
+            delete current_.load();
+        }
+
+        Reloadable(const Reloadable&) = delete;
+        Reloadable& operator=(const Reloadable&) = delete;
+
+        // Calls f(const Forword&) with the current snapshot and returns its result.
+        template <typename F>
+        decltype(auto) with(F&& f) const {
+            ReadGuard guard(*this);
+            return f(*guard.snapshot->forword);
+        }
+
+        bool search(std::string_view text) const {
+            return with([&](const Forword& forword) { return forword.search(text); });
+        }
+
+        std::string replace(std::string_view text, std::string_view replacement = "***") const {
+            return with([&](const Forword& forword) { return forword.replace(text, replacement); });
+        }
+
+        void replace_into(std::string_view text, std::string& out, std::string_view replacement = "***") const {
+            with([&](const Forword& forword) { forword.replace_into(text, out, replacement); });
+        }
+
+        // A state carries over reloads; see ScanState.
+        bool search_continue(ScanState& state, std::string_view text) const {
+            return with([&](const Forword& forword) { return forword.search_continue(state, text); });
+        }
+
+        std::string replace_continue(ScanState& state, std::string_view text, std::string_view replacement = "***") const {
+            return with([&](const Forword& forword) { return forword.replace_continue(state, text, replacement); });
+        }
+
+        // The current snapshot, kept alive for as long as the caller holds it
+        // (e.g. for a Scanner that spans several calls).
+        std::shared_ptr<const Forword> snapshot() const {
+            ReadGuard guard(*this);
+            return guard.snapshot->forword;
+        }
+
+        // Number of reloads published so far.
+        uint64_t generation() const {
+            ReadGuard guard(*this);
+            return guard.snapshot->generation;
+        }
+
+        // Rebuilds from the dictionary file and publishes the result. Returns
+        // once no reader can see the previous snapshot any more. If the file
+        // fails to load, the exception propagates and the old dictionary stays.
+        void reload() {
+            std::string file;
+            {
+                std::lock_guard<std::mutex> lock(writer_);
+                file = file_;
+            }
+            auto forword = std::make_shared<const Forword>(file, ignored_symbols_, options_);
+            std::lock_guard<std::mutex> lock(writer_);
+            publish(std::move(forword));
+        }
+
+        // Switches to another dictionary file.
+        void reload(const std::string& forbidden_words_file) {
+            auto forword = std::make_shared<const Forword>(forbidden_words_file, ignored_symbols_, options_);
+            std::lock_guard<std::mutex> lock(writer_);
+            file_ = forbidden_words_file;
+            publish(std::move(forword));
+        }
+
+        // Applies f(Forword&) to a copy of the current dictionary and
+        // publishes the copy, e.g. for add_word() and remove_word(). The copy
+        // shares the immutable tables (main automaton, dense DFA, prefilter)
+        // and copies only the delta state: the added words and their
+        // automaton, one removed-mark bit per word, and an empty result cache.
+        // add_word() and remove_word() then rebuild the delta automaton and
+        // the prefilter, so an update costs about the size of the delta plus
+        // one prefilter build, whatever the size of the dense DFA.
+        // The next reload() from the file drops these changes.
+        template <typename F>
+        void update(F&& f) {
+            std::lock_guard<std::mutex> lock(writer_);
+            auto forword = std::make_shared<Forword>(*current_.load()->forword);
+            f(*forword);
+            publish(std::move(forword));
+        }
+
+        // reload() on a background thread.
+        std::future<void> reload_async() {
+            return std::async(std::launch::async, [this] { reload(); });
+        }
+
+    private:
+        struct Snapshot {
+            std::shared_ptr<const Forword> forword;
+            uint64_t generation;
+        };
+
+        static constexpr size_t READER_SLOTS = 16;
+
+        struct alignas(64) ReaderCount {
+            std::atomic<size_t> count{0};
+        };
+
+        class ReadGuard {
+        public:
+            explicit ReadGuard(const Reloadable& owner)
+                : count_(owner.readers_[owner.epoch_.load() & 1][thread_slot() % READER_SLOTS].count) {
+                count_.fetch_add(1);
+                snapshot = owner.current_.load();
+            }
+
+            ~ReadGuard() {
+                count_.fetch_sub(1);
+            }
+
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+            const Snapshot* snapshot;
+
+        private:
+            std::atomic<size_t>& count_;
+        };
+
+        // Called with writer_ held.
+        void publish(std::shared_ptr<const Forword> forword) {
+            const Snapshot* old = current_.load();
+            current_.store(new Snapshot{std::move(forword), old->generation + 1});
+
+            // A reader that loaded the old pointer registered before the
+            // swap, under either parity if its epoch read was stale.
+            for (int flip = 0; flip < 2; flip++) {
+                size_t parity = epoch_.fetch_add(1) & 1;
+                while (readers_in(parity) != 0) {
+                    std::this_thread::yield();
+                }
+            }
+            delete old;
+        }
+
+        size_t readers_in(size_t parity) const {
+            size_t total = 0;
+            for (const ReaderCount& slot : readers_[parity]) {
+                total += slot.count.load();
+            }
+            return total;
+        }
+
+        std::string file_;
+        const IgnoredSymbols ignored_symbols_;
+        const Options options_;
+        std::atomic<const Snapshot*> current_{nullptr};
+        std::atomic<size_t> epoch_{0};
+        mutable ReaderCount readers_[2][READER_SLOTS];
+        std::mutex writer_;
+    };
+
+    // Returns the case- and accent-folded form of a UTF-8 string.
     static std::string normalize_utf8(const std::string & input) {
-        return std::get<0>(normalize_utf8_with_mapping(input));
+        std::string normalized;
+        normalized.reserve(input.size());
+        for_each_folded(input, [&](char32_t ch, size_t, size_t) {
+            append_utf8(normalized, ch);
+            return true;
+        });
+        return normalized;
     }
-
     std::string normalize_word(const std::string& word) const {
         std::string normalized;
         for (char ch : word) {
-            if (ignored_symbols_.find(ch) == ignored_symbols_.end() && is_word_char(ch)) {
+            if (!ignored_symbols_.contains(static_cast<unsigned char>(ch)) && is_word_char(ch)) {
                 normalized += ch;
             }
         }
@@ -537,9 +3678,14 @@ public:
 };
 
 // Define the static member variable
-const std::unordered_set<char> Forword::DEFAULT_IGNORED_SYMBOLS = {
-    ' ', '-', '.', '_', '\'', '"', '!', '?', '@', '#', '$', '%', '^', '&', '*',
-    '(', ')', '+', '=', '[', ']', '{', '}', '|', '\\', '/', ':', ';', ',', '<', '>'
+inline const Forword::IgnoredSymbols Forword::DEFAULT_IGNORED_SYMBOLS = {
+    U' ', U'-', U'.', U'_', U'\'', U'"', U'!', U'?', U'@', U'#', U'$', U'%', U'^', U'&', U'*',
+    U'(', U')', U'+', U'=', U'[', U']', U'{', U'}', U'|', U'\\', U'/', U':', U';', U',', U'<', U'>',
+    // CJK punctuation and brackets: 、 。 〃 〈 〉 《 》 「 」 『 』 【 】 ・
+    U'\u3001', U'\u3002', U'\u3003', U'\u3008', U'\u3009', U'\u300A', U'\u300B', U'\u300C',
+    U'\u300D', U'\u300E', U'\u300F', U'\u3010', U'\u3011', U'\u30FB',
+    // Zero-width space, joiners and no-break space used to split words invisibly
+    U'\u200B', U'\u200C', U'\u200D', U'\u2060', U'\uFEFF'
 };
 
 #endif // FORWORD_H 
\ No newline at end of file
@@ -0,0 +1,152 @@
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.Net.Sockets;
+using System.Text;
+
+namespace ForwordLib
+{
+    // Client for forwordd, the daemon that serves one C++ Forword dictionary
+    // to every process on the host over a Unix domain socket. See
+    // forword_client.h for the wire format.
+    //
+    // The batch calls pipeline their requests, so many small messages cost
+    // one round trip per window instead of one each. A client is not
+    // thread-safe; give each thread its own.
+    public class ForwordClient : IDisposable
+    {
+        public record Match(int Begin, int End, uint PatternId, string Word);  // byte offsets into the UTF-8 text
+
+        private const byte OpSearch = 1;
+        private const byte OpReplace = 2;
+        private const byte OpFindAll = 3;
+        private const byte StatusOk = 0;
+        private const int FrameHeader = 5;
+
+        public const int MaxFrame = 64 * 1024 * 1024;
+        public const int PipelineDepth = 256;
+        public const int PipelineBytes = 1024 * 1024;
+
+        private readonly Socket socket;
+        private readonly NetworkStream stream;
+        private uint nextId;
+
+        public ForwordClient(string socketPath)
+        {
+            socket = new Socket(AddressFamily.Unix, SocketType.Stream, ProtocolType.Unspecified);
+            socket.Connect(new UnixDomainSocketEndPoint(socketPath));
+            stream = new NetworkStream(socket, ownsSocket: true);
+        }
+
+        public void Dispose()
+        {
+            stream.Dispose();
+        }
+
+        public bool Search(string text) => SearchBatch(new[] { text })[0];
+
+        public string Replace(string text, string replacement = "***") => ReplaceBatch(new[] { text }, replacement)[0];
+
+        public List<Match> FindAll(string text)
+        {
+            byte[] payload = Pipeline(OpFindAll, new[] { text }, "")[0];
+            var matches = new List<Match>();
+            int offset = 4;
+            uint count = BinaryPrimitives.ReadUInt32LittleEndian(payload);
+            for (uint i = 0; i < count; i++)
+            {
+                var fields = payload.AsSpan(offset);
+                int begin = (int)BinaryPrimitives.ReadUInt32LittleEndian(fields);
+                int end = (int)BinaryPrimitives.ReadUInt32LittleEndian(fields.Slice(4));
+                uint patternId = BinaryPrimitives.ReadUInt32LittleEndian(fields.Slice(8));
+                int length = (int)BinaryPrimitives.ReadUInt32LittleEndian(fields.Slice(12));
+                offset += 16;
+                matches.Add(new Match(begin, end, patternId, Encoding.UTF8.GetString(payload, offset, length)));
+                offset += length;
+            }
+            return matches;
+        }
+
+        public List<bool> SearchBatch(IReadOnlyList<string> texts)
+        {
+            var result = new List<bool>(texts.Count);
+            foreach (var payload in Pipeline(OpSearch, texts, ""))
+            {
+                result.Add(payload.Length > 0 && payload[0] != 0);
+            }
+            return result;
+        }
+
+        public List<string> ReplaceBatch(IReadOnlyList<string> texts, string replacement = "***")
+        {
+            var result = new List<string>(texts.Count);
+            foreach (var payload in Pipeline(OpReplace, texts, replacement))
+            {
+                result.Add(Encoding.UTF8.GetString(payload));
+            }
+            return result;
+        }
+
+        private List<byte[]> Pipeline(byte op, IReadOnlyList<string> texts, string replacement)
+        {
+            byte[] replacementBytes = Encoding.UTF8.GetBytes(replacement);
+            var results = new List<byte[]>(texts.Count);
+            var window = new MemoryStream();
+            string? error = null;
+
+            for (int first = 0, last; first < texts.Count; first = last)
+            {
+                window.SetLength(0);
+                uint firstId = nextId;
+                for (last = first; last < texts.Count && last - first < PipelineDepth; last++)
+                {
+                    if (last > first && window.Length + Encoding.UTF8.GetByteCount(texts[last]) > PipelineBytes) break;
+                    WriteRequest(window, op, replacementBytes, Encoding.UTF8.GetBytes(texts[last]));
+                }
+                stream.Write(window.GetBuffer(), 0, (int)window.Length);
+
+                // Read the whole window even past an error, so the connection
+                // stays in step for the next call
+                for (int i = first; i < last; i++)
+                {
+                    var (ok, payload) = ReadResponse(firstId + (uint)(i - first));
+                    if (ok) results.Add(payload);
+                    else error ??= Encoding.UTF8.GetString(payload);
+                }
+                if (error != null) throw new InvalidOperationException("forwordd: " + error);
+            }
+            return results;
+        }
+
+        private void WriteRequest(MemoryStream window, byte op, byte[] replacement, byte[] text)
+        {
+            int size = FrameHeader + text.Length + (op == OpReplace ? 4 + replacement.Length : 0);
+            if (size > MaxFrame) throw new ArgumentException("Message exceeds MaxFrame");
+
+            Span<byte> header = stackalloc byte[13];
+            BinaryPrimitives.WriteUInt32LittleEndian(header, (uint)size);
+            BinaryPrimitives.WriteUInt32LittleEndian(header.Slice(4), nextId++);
+            header[8] = op;
+            BinaryPrimitives.WriteUInt32LittleEndian(header.Slice(9), (uint)replacement.Length);
+            window.Write(header.Slice(0, op == OpReplace ? 13 : 9));
+            if (op == OpReplace) window.Write(replacement);
+            window.Write(text);
+        }
+
+        private (bool, byte[]) ReadResponse(uint id)
+        {
+            byte[] header = new byte[4 + FrameHeader];
+            stream.ReadExactly(header);
+            uint size = BinaryPrimitives.ReadUInt32LittleEndian(header);
+            if (size < FrameHeader || size > MaxFrame || BinaryPrimitives.ReadUInt32LittleEndian(header.AsSpan(4)) != id)
+            {
+                Dispose();
+                throw new IOException("forwordd sent a malformed response");
+            }
+            byte[] payload = new byte[size - FrameHeader];
+            stream.ReadExactly(payload);
+            return (header[8] == StatusOk, payload);
+        }
+    }
+}
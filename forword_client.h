@@ -0,0 +1,311 @@
+#ifndef FORWORD_CLIENT_H
+#define FORWORD_CLIENT_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Client for forwordd, the daemon that serves one Forword dictionary to
+// every process on the host over a Unix domain socket.
+//
+// Wire format, all integers little-endian:
+//   request:  u32 size | u32 id | u8 op     | payload
+//   response: u32 size | u32 id | u8 status | payload
+// size counts the bytes after itself. id is chosen by the client and echoed
+// back; responses on a connection come back in request order.
+//   Search:  text                          -> u8 found
+//   Replace: u32 n | replacement[n] | text -> replaced text
+//   FindAll: text                          -> u32 count, then per match
+//            u32 begin | u32 end | u32 pattern_id | u32 n | word[n]
+// A failed request gets status Error and the message as payload, and so
+// does one whose response would exceed MAX_FRAME.
+//
+// Requests can be pipelined: search_batch() and replace_batch() send up to
+// PIPELINE_DEPTH requests (or PIPELINE_BYTES of them) before reading their
+// responses, so many small messages cost one round trip per window instead
+// of one each. A client is not thread-safe; give each thread its own.
+class ForwordClient {
+public:
+    enum class Op : uint8_t {
+        Search = 1,
+        Replace = 2,
+        FindAll = 3,
+    };
+
+    enum class Status : uint8_t {
+        Ok = 0,
+        Error = 1,
+    };
+
+    // Largest frame either side accepts; the daemon drops connections that
+    // send more.
+    static constexpr size_t MAX_FRAME = 64 * 1024 * 1024;
+
+    // Bytes of a frame after the size field: id and op or status.
+    static constexpr size_t FRAME_HEADER = 5;
+
+    // send() flags: a closed peer is an error, not a SIGPIPE.
+#if defined(MSG_NOSIGNAL)
+    static constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    static constexpr int SEND_FLAGS = 0;
+#endif
+
+    // Requests and request bytes in flight per window of a batch call. The
+    // daemon stops reading from a connection whose answers pile up unread,
+    // so a window must stay well below that limit.
+    static constexpr size_t PIPELINE_DEPTH = 256;
+    static constexpr size_t PIPELINE_BYTES = 1024 * 1024;
+
+    struct Match {
+        size_t begin;
+        size_t end;
+        uint32_t pattern_id;
+        std::string word;
+    };
+
+    explicit ForwordClient(const std::string& socket_path) {
+        sockaddr_un address{};
+        if (socket_path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Socket path too long: " + socket_path);
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+        fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd_ < 0 || ::fcntl(fd_, F_SETFD, FD_CLOEXEC) != 0 || ::connect(fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            close();
+            throw std::runtime_error("Failed to connect to forwordd: " + socket_path);
+        }
+    }
+
+    ~ForwordClient() { close(); }
+
+    ForwordClient(ForwordClient&& other) noexcept : fd_(other.fd_), next_id_(other.next_id_) {
+        other.fd_ = -1;
+    }
+
+    ForwordClient& operator=(ForwordClient&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd_ = other.fd_;
+            next_id_ = other.next_id_;
+            other.fd_ = -1;
+        }
+        return *this;
+    }
+
+    ForwordClient(const ForwordClient&) = delete;
+    ForwordClient& operator=(const ForwordClient&) = delete;
+
+    bool search(std::string_view text) {
+        out_.clear();
+        uint32_t id = write_request(Op::Search, "", text, out_);
+        send_all(out_);
+        return decode_search(expect_ok(id));
+    }
+
+    std::string replace(std::string_view text, std::string_view replacement = "***") {
+        out_.clear();
+        uint32_t id = write_request(Op::Replace, replacement, text, out_);
+        send_all(out_);
+        return expect_ok(id);
+    }
+
+    std::vector<Match> find_all(std::string_view text) {
+        out_.clear();
+        uint32_t id = write_request(Op::FindAll, "", text, out_);
+        send_all(out_);
+        return decode_find_all(expect_ok(id));
+    }
+
+    // search() for every message of texts (any indexable container of
+    // strings or string_views), pipelined.
+    template <typename Texts>
+    std::vector<bool> search_batch(const Texts& texts) {
+        std::vector<bool> result(std::size(texts));
+        pipeline(texts, Op::Search, "", [&](size_t i, std::string payload) {
+            result[i] = decode_search(payload);
+        });
+        return result;
+    }
+
+    // replace() for every message of texts, pipelined.
+    template <typename Texts>
+    std::vector<std::string> replace_batch(const Texts& texts, std::string_view replacement = "***") {
+        std::vector<std::string> result(std::size(texts));
+        pipeline(texts, Op::Replace, replacement, [&](size_t i, std::string payload) {
+            result[i] = std::move(payload);
+        });
+        return result;
+    }
+
+    // Frame encoding, shared with the daemon.
+    static void put_u32(std::string& out, uint32_t value) {
+        char bytes[4] = {static_cast<char>(value), static_cast<char>(value >> 8),
+                         static_cast<char>(value >> 16), static_cast<char>(value >> 24)};
+        out.append(bytes, 4);
+    }
+
+    static uint32_t get_u32(const char* p) {
+        const auto* b = reinterpret_cast<const unsigned char*>(p);
+        return uint32_t(b[0]) | uint32_t(b[1]) << 8 | uint32_t(b[2]) << 16 | uint32_t(b[3]) << 24;
+    }
+
+    // Appends a frame of size 0 whose size field is patched by end_frame().
+    static size_t begin_frame(std::string& out, uint32_t id, uint8_t op_or_status) {
+        size_t start = out.size();
+        put_u32(out, 0);
+        put_u32(out, id);
+        out.push_back(static_cast<char>(op_or_status));
+        return start;
+    }
+
+    // Throws std::length_error for a frame the other side would reject.
+    static void end_frame(std::string& out, size_t start) {
+        if (out.size() - start - 4 > MAX_FRAME) {
+            throw std::length_error("ForwordClient: frame exceeds MAX_FRAME");
+        }
+        uint32_t size = static_cast<uint32_t>(out.size() - start - 4);
+        for (int k = 0; k < 4; k++) {
+            out[start + k] = static_cast<char>(size >> (8 * k));
+        }
+    }
+
+private:
+    int fd_{-1};
+    uint32_t next_id_{0};
+    std::string out_;
+
+    void close() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    uint32_t write_request(Op op, std::string_view replacement, std::string_view text, std::string& out) {
+        if (text.size() + replacement.size() + 4 + FRAME_HEADER > MAX_FRAME) {
+            throw std::length_error("ForwordClient: message exceeds MAX_FRAME");
+        }
+        uint32_t id = next_id_++;
+        size_t start = begin_frame(out, id, static_cast<uint8_t>(op));
+        if (op == Op::Replace) {
+            put_u32(out, static_cast<uint32_t>(replacement.size()));
+            out.append(replacement);
+        }
+        out.append(text);
+        end_frame(out, start);
+        return id;
+    }
+
+    template <typename Texts, typename F>
+    void pipeline(const Texts& texts, Op op, std::string_view replacement, F&& on_response) {
+        const size_t count = std::size(texts);
+        for (size_t first = 0, last = 0; first < count; first = last) {
+            out_.clear();
+            uint32_t first_id = next_id_;
+            for (last = first; last < count && last - first < PIPELINE_DEPTH; last++) {
+                if (last > first && out_.size() + std::string_view(texts[last]).size() > PIPELINE_BYTES) break;
+                write_request(op, replacement, std::string_view(texts[last]), out_);
+            }
+            send_all(out_);
+
+            // Read the whole window even past an error, so the connection
+            // stays in step for the next call
+            std::string error;
+            for (size_t i = first; i < last; i++) {
+                std::string payload;
+                if (read_response(first_id + static_cast<uint32_t>(i - first), payload)) {
+                    on_response(i, std::move(payload));
+                } else if (error.empty()) {
+                    error = std::move(payload);
+                }
+            }
+            if (!error.empty()) throw std::runtime_error("forwordd: " + error);
+        }
+    }
+
+    void send_all(std::string_view data) {
+        while (!data.empty()) {
+            ssize_t n = ::send(fd_, data.data(), data.size(), SEND_FLAGS);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) throw std::runtime_error("forwordd connection lost");
+            data.remove_prefix(static_cast<size_t>(n));
+        }
+    }
+
+    void read_exact(char* p, size_t size) {
+        while (size > 0) {
+            ssize_t n = ::recv(fd_, p, size, 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) throw std::runtime_error("forwordd connection lost");
+            p += n;
+            size -= static_cast<size_t>(n);
+        }
+    }
+
+    // Reads the next response, which must answer request id, into payload.
+    // Returns false for an error response, whose payload is the message.
+    bool read_response(uint32_t id, std::string& payload) {
+        char header[4 + FRAME_HEADER];
+        read_exact(header, sizeof(header));
+        uint32_t size = get_u32(header);
+        if (size < FRAME_HEADER || size > MAX_FRAME || get_u32(header + 4) != id) {
+            close();
+            throw std::runtime_error("forwordd sent a malformed response");
+        }
+        payload.resize(size - FRAME_HEADER);
+        read_exact(payload.data(), payload.size());
+        return static_cast<Status>(header[8]) == Status::Ok;
+    }
+
+    std::string expect_ok(uint32_t id) {
+        std::string payload;
+        if (!read_response(id, payload)) {
+            throw std::runtime_error("forwordd: " + payload);
+        }
+        return payload;
+    }
+
+    static bool decode_search(const std::string& payload) {
+        return !payload.empty() && payload[0] != 0;
+    }
+
+    static std::vector<Match> decode_find_all(const std::string& payload) {
+        std::vector<Match> matches;
+        const char* p = payload.data();
+        const char* end = p + payload.size();
+        auto take = [&]() {
+            if (end - p < 4) throw std::runtime_error("forwordd sent a malformed response");
+            uint32_t value = get_u32(p);
+            p += 4;
+            return value;
+        };
+        for (uint32_t count = take(); count > 0; count--) {
+            Match m;
+            m.begin = take();
+            m.end = take();
+            m.pattern_id = take();
+            uint32_t length = take();
+            if (static_cast<size_t>(end - p) < length) throw std::runtime_error("forwordd sent a malformed response");
+            m.word.assign(p, length);
+            p += length;
+            matches.push_back(std::move(m));
+        }
+        return matches;
+    }
+};
+
+#endif
@@ -0,0 +1,128 @@
+from typing import Iterable, List, NamedTuple, Tuple
+import socket
+import struct
+
+
+class Match(NamedTuple):
+    begin: int       # byte offsets into the UTF-8 encoded text
+    end: int
+    pattern_id: int
+    word: str
+
+
+class ForwordClient:
+    """
+    Client for forwordd, the daemon that serves one C++ Forword dictionary to
+    every process on the host over a Unix domain socket. See forword_client.h
+    for the wire format.
+
+    The batch calls pipeline their requests, so many small messages cost one
+    round trip per window instead of one each. A client is not thread-safe;
+    give each thread its own.
+    """
+
+    OP_SEARCH = 1
+    OP_REPLACE = 2
+    OP_FIND_ALL = 3
+    STATUS_OK = 0
+
+    MAX_FRAME = 64 * 1024 * 1024
+    PIPELINE_DEPTH = 256
+    PIPELINE_BYTES = 1024 * 1024
+
+    _HEADER = struct.Struct("<IIB")  # size, id, op or status
+
+    def __init__(self, socket_path: str):
+        self._socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self._socket.connect(socket_path)
+        self._buffer = bytearray()
+        self._next_id = 0
+
+    def close(self) -> None:
+        self._socket.close()
+
+    def __enter__(self) -> "ForwordClient":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
+
+    def search(self, text: str) -> bool:
+        return self.search_batch([text])[0]
+
+    def replace(self, text: str, replacement: str = "***") -> str:
+        return self.replace_batch([text], replacement)[0]
+
+    def find_all(self, text: str) -> List[Match]:
+        payload = self._pipeline(self.OP_FIND_ALL, [text])[0]
+        matches = []
+        (count,), offset = struct.unpack_from("<I", payload), 4
+        for _ in range(count):
+            begin, end, pattern_id, length = struct.unpack_from("<IIII", payload, offset)
+            offset += 16
+            word = payload[offset:offset + length].decode("utf-8")
+            offset += length
+            matches.append(Match(begin, end, pattern_id, word))
+        return matches
+
+    def search_batch(self, texts: Iterable[str]) -> List[bool]:
+        return [payload[0] != 0 for payload in self._pipeline(self.OP_SEARCH, texts)]
+
+    def replace_batch(self, texts: Iterable[str], replacement: str = "***") -> List[str]:
+        return [payload.decode("utf-8", "surrogateescape")
+                for payload in self._pipeline(self.OP_REPLACE, texts, replacement)]
+
+    def _pipeline(self, op: int, texts: Iterable[str], replacement: str = "") -> List[bytes]:
+        prefix = b""
+        if op == self.OP_REPLACE:
+            encoded = replacement.encode("utf-8")
+            prefix = struct.pack("<I", len(encoded)) + encoded
+
+        results: List[bytes] = []
+        error = None
+        window: List[bytes] = []
+        window_bytes = 0
+        texts = [text.encode("utf-8", "surrogateescape") for text in texts]
+        for i, text in enumerate(texts):
+            window.append(self._frame(op, prefix + text))
+            window_bytes += len(window[-1])
+            last = i + 1 == len(texts)
+            if last or len(window) == self.PIPELINE_DEPTH or window_bytes + len(texts[i + 1]) > self.PIPELINE_BYTES:
+                first_id = (self._next_id - len(window)) & 0xFFFFFFFF
+                self._socket.sendall(b"".join(window))
+                # Read the whole window even past an error, so the connection
+                # stays in step for the next call
+                for k in range(len(window)):
+                    ok, payload = self._read_response((first_id + k) & 0xFFFFFFFF)
+                    if ok:
+                        results.append(payload)
+                    elif error is None:
+                        error = payload.decode("utf-8", "replace")
+                window, window_bytes = [], 0
+                if error is not None:
+                    raise RuntimeError("forwordd: " + error)
+        return results
+
+    def _frame(self, op: int, payload: bytes) -> bytes:
+        if len(payload) + 5 > self.MAX_FRAME:
+            raise ValueError("message exceeds MAX_FRAME")
+        request_id = self._next_id
+        self._next_id = (self._next_id + 1) & 0xFFFFFFFF
+        return self._HEADER.pack(len(payload) + 5, request_id, op) + payload
+
+    def _read_exact(self, size: int) -> bytes:
+        while len(self._buffer) < size:
+            chunk = self._socket.recv(max(size - len(self._buffer), 65536))
+            if not chunk:
+                raise ConnectionError("forwordd connection lost")
+            self._buffer += chunk
+        data = bytes(self._buffer[:size])
+        del self._buffer[:size]
+        return data
+
+    def _read_response(self, request_id: int) -> Tuple[bool, bytes]:
+        size, response_id, status = self._HEADER.unpack(self._read_exact(self._HEADER.size))
+        if size < 5 or size > self.MAX_FRAME or response_id != request_id:
+            self.close()
+            raise ConnectionError("forwordd sent a malformed response")
+        return status == self.STATUS_OK, self._read_exact(size - 5)
@@ -0,0 +1,3268 @@
+// Generated by tools/gen_fold_table.py from Unicode 14.0.0. Do not edit.
+#ifndef FORWORD_FOLD_TABLE_H
+#define FORWORD_FOLD_TABLE_H
+
+#include <cstdint>
+
+namespace forword_fold {
+
+// Folded form of a code point: length 0 drops it, length 1 adds delta
+// to it, and longer results are spelled out in chars.
+struct Value {
+    int32_t delta;
+    uint32_t length;
+    char32_t chars[3];
+};
+
+inline constexpr uint32_t BLOCK_SHIFT = 8;
+inline constexpr uint32_t MAX_EXPANSION = 3;
+inline constexpr char UNICODE_VERSION[] = "14.0.0";
+
+inline constexpr Value values[2160] = {
+    {0, 1, {0x0, 0x0, 0x0}},
+    {32, 1, {0x0, 0x0, 0x0}},
+    {775, 1, {0x0, 0x0, 0x0}},
+    {-95, 1, {0x0, 0x0, 0x0}},
+    {-96, 1, {0x0, 0x0, 0x0}},
+    {-97, 1, {0x0, 0x0, 0x0}},
+    {-98, 1, {0x0, 0x0, 0x0}},
+    {-99, 1, {0x0, 0x0, 0x0}},
+    {-100, 1, {0x0, 0x0, 0x0}},
+    {-101, 1, {0x0, 0x0, 0x0}},
+    {-102, 1, {0x0, 0x0, 0x0}},
+    {-103, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x73, 0x73, 0x0}},
+    {-127, 1, {0x0, 0x0, 0x0}},
+    {-128, 1, {0x0, 0x0, 0x0}},
+    {-129, 1, {0x0, 0x0, 0x0}},
+    {-130, 1, {0x0, 0x0, 0x0}},
+    {-131, 1, {0x0, 0x0, 0x0}},
+    {-132, 1, {0x0, 0x0, 0x0}},
+    {-133, 1, {0x0, 0x0, 0x0}},
+    {-134, 1, {0x0, 0x0, 0x0}},
+    {-135, 1, {0x0, 0x0, 0x0}},
+    {-159, 1, {0x0, 0x0, 0x0}},
+    {-160, 1, {0x0, 0x0, 0x0}},
+    {-161, 1, {0x0, 0x0, 0x0}},
+    {-162, 1, {0x0, 0x0, 0x0}},
+    {-163, 1, {0x0, 0x0, 0x0}},
+    {-164, 1, {0x0, 0x0, 0x0}},
+    {-165, 1, {0x0, 0x0, 0x0}},
+    {-166, 1, {0x0, 0x0, 0x0}},
+    {-167, 1, {0x0, 0x0, 0x0}},
+    {-168, 1, {0x0, 0x0, 0x0}},
+    {-169, 1, {0x0, 0x0, 0x0}},
+    {-170, 1, {0x0, 0x0, 0x0}},
+    {-171, 1, {0x0, 0x0, 0x0}},
+    {1, 1, {0x0, 0x0, 0x0}},
+    {-173, 1, {0x0, 0x0, 0x0}},
+    {-174, 1, {0x0, 0x0, 0x0}},
+    {-175, 1, {0x0, 0x0, 0x0}},
+    {-176, 1, {0x0, 0x0, 0x0}},
+    {-177, 1, {0x0, 0x0, 0x0}},
+    {-178, 1, {0x0, 0x0, 0x0}},
+    {-179, 1, {0x0, 0x0, 0x0}},
+    {-180, 1, {0x0, 0x0, 0x0}},
+    {-181, 1, {0x0, 0x0, 0x0}},
+    {-182, 1, {0x0, 0x0, 0x0}},
+    {-183, 1, {0x0, 0x0, 0x0}},
+    {-184, 1, {0x0, 0x0, 0x0}},
+    {-185, 1, {0x0, 0x0, 0x0}},
+    {-186, 1, {0x0, 0x0, 0x0}},
+    {-187, 1, {0x0, 0x0, 0x0}},
+    {-188, 1, {0x0, 0x0, 0x0}},
+    {-189, 1, {0x0, 0x0, 0x0}},
+    {-191, 1, {0x0, 0x0, 0x0}},
+    {-192, 1, {0x0, 0x0, 0x0}},
+    {-193, 1, {0x0, 0x0, 0x0}},
+    {-194, 1, {0x0, 0x0, 0x0}},
+    {-195, 1, {0x0, 0x0, 0x0}},
+    {-196, 1, {0x0, 0x0, 0x0}},
+    {-197, 1, {0x0, 0x0, 0x0}},
+    {-198, 1, {0x0, 0x0, 0x0}},
+    {-199, 1, {0x0, 0x0, 0x0}},
+    {-202, 1, {0x0, 0x0, 0x0}},
+    {-203, 1, {0x0, 0x0, 0x0}},
+    {-204, 1, {0x0, 0x0, 0x0}},
+    {-205, 1, {0x0, 0x0, 0x0}},
+    {-206, 1, {0x0, 0x0, 0x0}},
+    {-207, 1, {0x0, 0x0, 0x0}},
+    {-208, 1, {0x0, 0x0, 0x0}},
+    {-209, 1, {0x0, 0x0, 0x0}},
+    {-210, 1, {0x0, 0x0, 0x0}},
+    {-213, 1, {0x0, 0x0, 0x0}},
+    {-214, 1, {0x0, 0x0, 0x0}},
+    {-215, 1, {0x0, 0x0, 0x0}},
+    {-216, 1, {0x0, 0x0, 0x0}},
+    {-217, 1, {0x0, 0x0, 0x0}},
+    {-218, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x2BC, 0x6E, 0x0}},
+    {-221, 1, {0x0, 0x0, 0x0}},
+    {-222, 1, {0x0, 0x0, 0x0}},
+    {-223, 1, {0x0, 0x0, 0x0}},
+    {-224, 1, {0x0, 0x0, 0x0}},
+    {-225, 1, {0x0, 0x0, 0x0}},
+    {-226, 1, {0x0, 0x0, 0x0}},
+    {-227, 1, {0x0, 0x0, 0x0}},
+    {-228, 1, {0x0, 0x0, 0x0}},
+    {-229, 1, {0x0, 0x0, 0x0}},
+    {-230, 1, {0x0, 0x0, 0x0}},
+    {-231, 1, {0x0, 0x0, 0x0}},
+    {-232, 1, {0x0, 0x0, 0x0}},
+    {-233, 1, {0x0, 0x0, 0x0}},
+    {-234, 1, {0x0, 0x0, 0x0}},
+    {-235, 1, {0x0, 0x0, 0x0}},
+    {-236, 1, {0x0, 0x0, 0x0}},
+    {-237, 1, {0x0, 0x0, 0x0}},
+    {-238, 1, {0x0, 0x0, 0x0}},
+    {-239, 1, {0x0, 0x0, 0x0}},
+    {-240, 1, {0x0, 0x0, 0x0}},
+    {-241, 1, {0x0, 0x0, 0x0}},
+    {-243, 1, {0x0, 0x0, 0x0}},
+    {-244, 1, {0x0, 0x0, 0x0}},
+    {-245, 1, {0x0, 0x0, 0x0}},
+    {-246, 1, {0x0, 0x0, 0x0}},
+    {-247, 1, {0x0, 0x0, 0x0}},
+    {-248, 1, {0x0, 0x0, 0x0}},
+    {-249, 1, {0x0, 0x0, 0x0}},
+    {-250, 1, {0x0, 0x0, 0x0}},
+    {-251, 1, {0x0, 0x0, 0x0}},
+    {-252, 1, {0x0, 0x0, 0x0}},
+    {-253, 1, {0x0, 0x0, 0x0}},
+    {-254, 1, {0x0, 0x0, 0x0}},
+    {-255, 1, {0x0, 0x0, 0x0}},
+    {-256, 1, {0x0, 0x0, 0x0}},
+    {-257, 1, {0x0, 0x0, 0x0}},
+    {-258, 1, {0x0, 0x0, 0x0}},
+    {-259, 1, {0x0, 0x0, 0x0}},
+    {-260, 1, {0x0, 0x0, 0x0}},
+    {-268, 1, {0x0, 0x0, 0x0}},
+    {210, 1, {0x0, 0x0, 0x0}},
+    {206, 1, {0x0, 0x0, 0x0}},
+    {205, 1, {0x0, 0x0, 0x0}},
+    {79, 1, {0x0, 0x0, 0x0}},
+    {202, 1, {0x0, 0x0, 0x0}},
+    {203, 1, {0x0, 0x0, 0x0}},
+    {207, 1, {0x0, 0x0, 0x0}},
+    {211, 1, {0x0, 0x0, 0x0}},
+    {209, 1, {0x0, 0x0, 0x0}},
+    {213, 1, {0x0, 0x0, 0x0}},
+    {214, 1, {0x0, 0x0, 0x0}},
+    {-305, 1, {0x0, 0x0, 0x0}},
+    {-306, 1, {0x0, 0x0, 0x0}},
+    {218, 1, {0x0, 0x0, 0x0}},
+    {-314, 1, {0x0, 0x0, 0x0}},
+    {-315, 1, {0x0, 0x0, 0x0}},
+    {217, 1, {0x0, 0x0, 0x0}},
+    {219, 1, {0x0, 0x0, 0x0}},
+    {2, 1, {0x0, 0x0, 0x0}},
+    {-364, 1, {0x0, 0x0, 0x0}},
+    {-365, 1, {0x0, 0x0, 0x0}},
+    {-358, 1, {0x0, 0x0, 0x0}},
+    {-359, 1, {0x0, 0x0, 0x0}},
+    {-354, 1, {0x0, 0x0, 0x0}},
+    {-355, 1, {0x0, 0x0, 0x0}},
+    {-350, 1, {0x0, 0x0, 0x0}},
+    {-351, 1, {0x0, 0x0, 0x0}},
+    {-352, 1, {0x0, 0x0, 0x0}},
+    {-353, 1, {0x0, 0x0, 0x0}},
+    {-356, 1, {0x0, 0x0, 0x0}},
+    {-357, 1, {0x0, 0x0, 0x0}},
+    {-381, 1, {0x0, 0x0, 0x0}},
+    {-382, 1, {0x0, 0x0, 0x0}},
+    {-383, 1, {0x0, 0x0, 0x0}},
+    {-384, 1, {0x0, 0x0, 0x0}},
+    {-379, 1, {0x0, 0x0, 0x0}},
+    {-380, 1, {0x0, 0x0, 0x0}},
+    {164, 1, {0x0, 0x0, 0x0}},
+    {163, 1, {0x0, 0x0, 0x0}},
+    {-390, 1, {0x0, 0x0, 0x0}},
+    {-397, 1, {0x0, 0x0, 0x0}},
+    {-398, 1, {0x0, 0x0, 0x0}},
+    {-56, 1, {0x0, 0x0, 0x0}},
+    {-394, 1, {0x0, 0x0, 0x0}},
+    {-395, 1, {0x0, 0x0, 0x0}},
+    {-409, 1, {0x0, 0x0, 0x0}},
+    {-410, 1, {0x0, 0x0, 0x0}},
+    {-278, 1, {0x0, 0x0, 0x0}},
+    {-279, 1, {0x0, 0x0, 0x0}},
+    {-262, 1, {0x0, 0x0, 0x0}},
+    {-263, 1, {0x0, 0x0, 0x0}},
+    {-415, 1, {0x0, 0x0, 0x0}},
+    {-416, 1, {0x0, 0x0, 0x0}},
+    {-417, 1, {0x0, 0x0, 0x0}},
+    {-418, 1, {0x0, 0x0, 0x0}},
+    {-413, 1, {0x0, 0x0, 0x0}},
+    {-414, 1, {0x0, 0x0, 0x0}},
+    {-421, 1, {0x0, 0x0, 0x0}},
+    {-422, 1, {0x0, 0x0, 0x0}},
+    {-423, 1, {0x0, 0x0, 0x0}},
+    {-438, 1, {0x0, 0x0, 0x0}},
+    {-439, 1, {0x0, 0x0, 0x0}},
+    {-453, 1, {0x0, 0x0, 0x0}},
+    {-454, 1, {0x0, 0x0, 0x0}},
+    {-451, 1, {0x0, 0x0, 0x0}},
+    {-452, 1, {0x0, 0x0, 0x0}},
+    {-443, 1, {0x0, 0x0, 0x0}},
+    {-444, 1, {0x0, 0x0, 0x0}},
+    {-445, 1, {0x0, 0x0, 0x0}},
+    {-446, 1, {0x0, 0x0, 0x0}},
+    {-447, 1, {0x0, 0x0, 0x0}},
+    {-448, 1, {0x0, 0x0, 0x0}},
+    {-449, 1, {0x0, 0x0, 0x0}},
+    {-450, 1, {0x0, 0x0, 0x0}},
+    {-441, 1, {0x0, 0x0, 0x0}},
+    {-442, 1, {0x0, 0x0, 0x0}},
+    {10795, 1, {0x0, 0x0, 0x0}},
+    {10792, 1, {0x0, 0x0, 0x0}},
+    {69, 1, {0x0, 0x0, 0x0}},
+    {71, 1, {0x0, 0x0, 0x0}},
+    {0, 0, {0x0, 0x0, 0x0}},
+    {116, 1, {0x0, 0x0, 0x0}},
+    {-835, 1, {0x0, 0x0, 0x0}},
+    {-733, 1, {0x0, 0x0, 0x0}},
+    {43, 1, {0x0, 0x0, 0x0}},
+    {-720, 1, {0x0, 0x0, 0x0}},
+    {45, 1, {0x0, 0x0, 0x0}},
+    {46, 1, {0x0, 0x0, 0x0}},
+    {47, 1, {0x0, 0x0, 0x0}},
+    {51, 1, {0x0, 0x0, 0x0}},
+    {55, 1, {0x0, 0x0, 0x0}},
+    {58, 1, {0x0, 0x0, 0x0}},
+    {41, 1, {0x0, 0x0, 0x0}},
+    {15, 1, {0x0, 0x0, 0x0}},
+    {26, 1, {0x0, 0x0, 0x0}},
+    {5, 1, {0x0, 0x0, 0x0}},
+    {8, 1, {0x0, 0x0, 0x0}},
+    {9, 1, {0x0, 0x0, 0x0}},
+    {10, 1, {0x0, 0x0, 0x0}},
+    {21, 1, {0x0, 0x0, 0x0}},
+    {-17, 1, {0x0, 0x0, 0x0}},
+    {-6, 1, {0x0, 0x0, 0x0}},
+    {-13, 1, {0x0, 0x0, 0x0}},
+    {-8, 1, {0x0, 0x0, 0x0}},
+    {-5, 1, {0x0, 0x0, 0x0}},
+    {-30, 1, {0x0, 0x0, 0x0}},
+    {-25, 1, {0x0, 0x0, 0x0}},
+    {-1, 1, {0x0, 0x0, 0x0}},
+    {-2, 1, {0x0, 0x0, 0x0}},
+    {-15, 1, {0x0, 0x0, 0x0}},
+    {-22, 1, {0x0, 0x0, 0x0}},
+    {-54, 1, {0x0, 0x0, 0x0}},
+    {-48, 1, {0x0, 0x0, 0x0}},
+    {-60, 1, {0x0, 0x0, 0x0}},
+    {-64, 1, {0x0, 0x0, 0x0}},
+    {-7, 1, {0x0, 0x0, 0x0}},
+    {53, 1, {0x0, 0x0, 0x0}},
+    {52, 1, {0x0, 0x0, 0x0}},
+    {80, 1, {0x0, 0x0, 0x0}},
+    {48, 1, {0x0, 0x0, 0x0}},
+    {31, 1, {0x0, 0x0, 0x0}},
+    {-27, 1, {0x0, 0x0, 0x0}},
+    {-28, 1, {0x0, 0x0, 0x0}},
+    {-32, 1, {0x0, 0x0, 0x0}},
+    {-34, 1, {0x0, 0x0, 0x0}},
+    {-37, 1, {0x0, 0x0, 0x0}},
+    {-139, 1, {0x0, 0x0, 0x0}},
+    {-140, 1, {0x0, 0x0, 0x0}},
+    {-172, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x565, 0x582, 0x0}},
+    {0, 2, {0x915, 0x93C, 0x0}},
+    {0, 2, {0x916, 0x93C, 0x0}},
+    {0, 2, {0x917, 0x93C, 0x0}},
+    {0, 2, {0x91C, 0x93C, 0x0}},
+    {0, 2, {0x921, 0x93C, 0x0}},
+    {0, 2, {0x922, 0x93C, 0x0}},
+    {0, 2, {0x92B, 0x93C, 0x0}},
+    {0, 2, {0x92F, 0x93C, 0x0}},
+    {0, 2, {0x9A1, 0x9BC, 0x0}},
+    {0, 2, {0x9A2, 0x9BC, 0x0}},
+    {0, 2, {0x9AF, 0x9BC, 0x0}},
+    {0, 2, {0xA32, 0xA3C, 0x0}},
+    {0, 2, {0xA38, 0xA3C, 0x0}},
+    {0, 2, {0xA16, 0xA3C, 0x0}},
+    {0, 2, {0xA17, 0xA3C, 0x0}},
+    {0, 2, {0xA1C, 0xA3C, 0x0}},
+    {0, 2, {0xA2B, 0xA3C, 0x0}},
+    {0, 2, {0xB21, 0xB3C, 0x0}},
+    {0, 2, {0xB22, 0xB3C, 0x0}},
+    {0, 2, {0xF42, 0xFB7, 0x0}},
+    {0, 2, {0xF4C, 0xFB7, 0x0}},
+    {0, 2, {0xF51, 0xFB7, 0x0}},
+    {0, 2, {0xF56, 0xFB7, 0x0}},
+    {0, 2, {0xF5B, 0xFB7, 0x0}},
+    {0, 2, {0xF40, 0xFB5, 0x0}},
+    {0, 2, {0xF71, 0xF72, 0x0}},
+    {0, 2, {0xF71, 0xF74, 0x0}},
+    {0, 2, {0xFB2, 0xF80, 0x0}},
+    {0, 2, {0xFB3, 0xF80, 0x0}},
+    {0, 2, {0xF71, 0xF80, 0x0}},
+    {0, 2, {0xF92, 0xFB7, 0x0}},
+    {0, 2, {0xF9C, 0xFB7, 0x0}},
+    {0, 2, {0xFA1, 0xFB7, 0x0}},
+    {0, 2, {0xFA6, 0xFB7, 0x0}},
+    {0, 2, {0xFAB, 0xFB7, 0x0}},
+    {0, 2, {0xF90, 0xFB5, 0x0}},
+    {7264, 1, {0x0, 0x0, 0x0}},
+    {-6222, 1, {0x0, 0x0, 0x0}},
+    {-6221, 1, {0x0, 0x0, 0x0}},
+    {-6212, 1, {0x0, 0x0, 0x0}},
+    {-6210, 1, {0x0, 0x0, 0x0}},
+    {-6211, 1, {0x0, 0x0, 0x0}},
+    {-6204, 1, {0x0, 0x0, 0x0}},
+    {-6180, 1, {0x0, 0x0, 0x0}},
+    {35267, 1, {0x0, 0x0, 0x0}},
+    {-3008, 1, {0x0, 0x0, 0x0}},
+    {-7583, 1, {0x0, 0x0, 0x0}},
+    {-7584, 1, {0x0, 0x0, 0x0}},
+    {-7585, 1, {0x0, 0x0, 0x0}},
+    {-7586, 1, {0x0, 0x0, 0x0}},
+    {-7587, 1, {0x0, 0x0, 0x0}},
+    {-7588, 1, {0x0, 0x0, 0x0}},
+    {-7589, 1, {0x0, 0x0, 0x0}},
+    {-7590, 1, {0x0, 0x0, 0x0}},
+    {-7591, 1, {0x0, 0x0, 0x0}},
+    {-7592, 1, {0x0, 0x0, 0x0}},
+    {-7593, 1, {0x0, 0x0, 0x0}},
+    {-7594, 1, {0x0, 0x0, 0x0}},
+    {-7595, 1, {0x0, 0x0, 0x0}},
+    {-7596, 1, {0x0, 0x0, 0x0}},
+    {-7597, 1, {0x0, 0x0, 0x0}},
+    {-7598, 1, {0x0, 0x0, 0x0}},
+    {-7599, 1, {0x0, 0x0, 0x0}},
+    {-7600, 1, {0x0, 0x0, 0x0}},
+    {-7601, 1, {0x0, 0x0, 0x0}},
+    {-7602, 1, {0x0, 0x0, 0x0}},
+    {-7603, 1, {0x0, 0x0, 0x0}},
+    {-7604, 1, {0x0, 0x0, 0x0}},
+    {-7605, 1, {0x0, 0x0, 0x0}},
+    {-7606, 1, {0x0, 0x0, 0x0}},
+    {-7607, 1, {0x0, 0x0, 0x0}},
+    {-7608, 1, {0x0, 0x0, 0x0}},
+    {-7609, 1, {0x0, 0x0, 0x0}},
+    {-7610, 1, {0x0, 0x0, 0x0}},
+    {-7611, 1, {0x0, 0x0, 0x0}},
+    {-7612, 1, {0x0, 0x0, 0x0}},
+    {-7613, 1, {0x0, 0x0, 0x0}},
+    {-7614, 1, {0x0, 0x0, 0x0}},
+    {-7615, 1, {0x0, 0x0, 0x0}},
+    {-7616, 1, {0x0, 0x0, 0x0}},
+    {-7617, 1, {0x0, 0x0, 0x0}},
+    {-7618, 1, {0x0, 0x0, 0x0}},
+    {-7619, 1, {0x0, 0x0, 0x0}},
+    {-7620, 1, {0x0, 0x0, 0x0}},
+    {-7621, 1, {0x0, 0x0, 0x0}},
+    {-7622, 1, {0x0, 0x0, 0x0}},
+    {-7623, 1, {0x0, 0x0, 0x0}},
+    {-7624, 1, {0x0, 0x0, 0x0}},
+    {-7625, 1, {0x0, 0x0, 0x0}},
+    {-7626, 1, {0x0, 0x0, 0x0}},
+    {-7627, 1, {0x0, 0x0, 0x0}},
+    {-7628, 1, {0x0, 0x0, 0x0}},
+    {-7629, 1, {0x0, 0x0, 0x0}},
+    {-7630, 1, {0x0, 0x0, 0x0}},
+    {-7631, 1, {0x0, 0x0, 0x0}},
+    {-7632, 1, {0x0, 0x0, 0x0}},
+    {-7633, 1, {0x0, 0x0, 0x0}},
+    {-7634, 1, {0x0, 0x0, 0x0}},
+    {-7635, 1, {0x0, 0x0, 0x0}},
+    {-7636, 1, {0x0, 0x0, 0x0}},
+    {-7637, 1, {0x0, 0x0, 0x0}},
+    {-7638, 1, {0x0, 0x0, 0x0}},
+    {-7639, 1, {0x0, 0x0, 0x0}},
+    {-7640, 1, {0x0, 0x0, 0x0}},
+    {-7641, 1, {0x0, 0x0, 0x0}},
+    {-7642, 1, {0x0, 0x0, 0x0}},
+    {-7643, 1, {0x0, 0x0, 0x0}},
+    {-7644, 1, {0x0, 0x0, 0x0}},
+    {-7645, 1, {0x0, 0x0, 0x0}},
+    {-7646, 1, {0x0, 0x0, 0x0}},
+    {-7647, 1, {0x0, 0x0, 0x0}},
+    {-7648, 1, {0x0, 0x0, 0x0}},
+    {-7649, 1, {0x0, 0x0, 0x0}},
+    {-7650, 1, {0x0, 0x0, 0x0}},
+    {-7651, 1, {0x0, 0x0, 0x0}},
+    {-7652, 1, {0x0, 0x0, 0x0}},
+    {-7653, 1, {0x0, 0x0, 0x0}},
+    {-7654, 1, {0x0, 0x0, 0x0}},
+    {-7655, 1, {0x0, 0x0, 0x0}},
+    {-7656, 1, {0x0, 0x0, 0x0}},
+    {-7657, 1, {0x0, 0x0, 0x0}},
+    {-7658, 1, {0x0, 0x0, 0x0}},
+    {-7659, 1, {0x0, 0x0, 0x0}},
+    {-7660, 1, {0x0, 0x0, 0x0}},
+    {-7661, 1, {0x0, 0x0, 0x0}},
+    {-7662, 1, {0x0, 0x0, 0x0}},
+    {-7663, 1, {0x0, 0x0, 0x0}},
+    {-7664, 1, {0x0, 0x0, 0x0}},
+    {-7665, 1, {0x0, 0x0, 0x0}},
+    {-7666, 1, {0x0, 0x0, 0x0}},
+    {-7667, 1, {0x0, 0x0, 0x0}},
+    {-7668, 1, {0x0, 0x0, 0x0}},
+    {-7669, 1, {0x0, 0x0, 0x0}},
+    {-7670, 1, {0x0, 0x0, 0x0}},
+    {-7671, 1, {0x0, 0x0, 0x0}},
+    {-7672, 1, {0x0, 0x0, 0x0}},
+    {-7673, 1, {0x0, 0x0, 0x0}},
+    {-7674, 1, {0x0, 0x0, 0x0}},
+    {-7675, 1, {0x0, 0x0, 0x0}},
+    {-7676, 1, {0x0, 0x0, 0x0}},
+    {-7677, 1, {0x0, 0x0, 0x0}},
+    {-7678, 1, {0x0, 0x0, 0x0}},
+    {-7679, 1, {0x0, 0x0, 0x0}},
+    {-7680, 1, {0x0, 0x0, 0x0}},
+    {-7681, 1, {0x0, 0x0, 0x0}},
+    {-7682, 1, {0x0, 0x0, 0x0}},
+    {-7683, 1, {0x0, 0x0, 0x0}},
+    {-7684, 1, {0x0, 0x0, 0x0}},
+    {-7685, 1, {0x0, 0x0, 0x0}},
+    {-7686, 1, {0x0, 0x0, 0x0}},
+    {-7687, 1, {0x0, 0x0, 0x0}},
+    {-7688, 1, {0x0, 0x0, 0x0}},
+    {-7689, 1, {0x0, 0x0, 0x0}},
+    {-7690, 1, {0x0, 0x0, 0x0}},
+    {-7691, 1, {0x0, 0x0, 0x0}},
+    {-7692, 1, {0x0, 0x0, 0x0}},
+    {-7693, 1, {0x0, 0x0, 0x0}},
+    {-7694, 1, {0x0, 0x0, 0x0}},
+    {-7695, 1, {0x0, 0x0, 0x0}},
+    {-7696, 1, {0x0, 0x0, 0x0}},
+    {-7697, 1, {0x0, 0x0, 0x0}},
+    {-7698, 1, {0x0, 0x0, 0x0}},
+    {-7699, 1, {0x0, 0x0, 0x0}},
+    {-7700, 1, {0x0, 0x0, 0x0}},
+    {-7701, 1, {0x0, 0x0, 0x0}},
+    {-7702, 1, {0x0, 0x0, 0x0}},
+    {-7703, 1, {0x0, 0x0, 0x0}},
+    {-7704, 1, {0x0, 0x0, 0x0}},
+    {-7705, 1, {0x0, 0x0, 0x0}},
+    {-7706, 1, {0x0, 0x0, 0x0}},
+    {-7707, 1, {0x0, 0x0, 0x0}},
+    {-7726, 1, {0x0, 0x0, 0x0}},
+    {-7715, 1, {0x0, 0x0, 0x0}},
+    {-7713, 1, {0x0, 0x0, 0x0}},
+    {-7712, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x61, 0x2BE, 0x0}},
+    {-7720, 1, {0x0, 0x0, 0x0}},
+    {-7743, 1, {0x0, 0x0, 0x0}},
+    {-7744, 1, {0x0, 0x0, 0x0}},
+    {-7745, 1, {0x0, 0x0, 0x0}},
+    {-7746, 1, {0x0, 0x0, 0x0}},
+    {-7747, 1, {0x0, 0x0, 0x0}},
+    {-7748, 1, {0x0, 0x0, 0x0}},
+    {-7749, 1, {0x0, 0x0, 0x0}},
+    {-7750, 1, {0x0, 0x0, 0x0}},
+    {-7751, 1, {0x0, 0x0, 0x0}},
+    {-7752, 1, {0x0, 0x0, 0x0}},
+    {-7753, 1, {0x0, 0x0, 0x0}},
+    {-7754, 1, {0x0, 0x0, 0x0}},
+    {-7755, 1, {0x0, 0x0, 0x0}},
+    {-7756, 1, {0x0, 0x0, 0x0}},
+    {-7757, 1, {0x0, 0x0, 0x0}},
+    {-7758, 1, {0x0, 0x0, 0x0}},
+    {-7759, 1, {0x0, 0x0, 0x0}},
+    {-7760, 1, {0x0, 0x0, 0x0}},
+    {-7761, 1, {0x0, 0x0, 0x0}},
+    {-7762, 1, {0x0, 0x0, 0x0}},
+    {-7763, 1, {0x0, 0x0, 0x0}},
+    {-7764, 1, {0x0, 0x0, 0x0}},
+    {-7765, 1, {0x0, 0x0, 0x0}},
+    {-7766, 1, {0x0, 0x0, 0x0}},
+    {-7767, 1, {0x0, 0x0, 0x0}},
+    {-7768, 1, {0x0, 0x0, 0x0}},
+    {-7769, 1, {0x0, 0x0, 0x0}},
+    {-7770, 1, {0x0, 0x0, 0x0}},
+    {-7771, 1, {0x0, 0x0, 0x0}},
+    {-7772, 1, {0x0, 0x0, 0x0}},
+    {-7773, 1, {0x0, 0x0, 0x0}},
+    {-7774, 1, {0x0, 0x0, 0x0}},
+    {-7775, 1, {0x0, 0x0, 0x0}},
+    {-7776, 1, {0x0, 0x0, 0x0}},
+    {-7777, 1, {0x0, 0x0, 0x0}},
+    {-7778, 1, {0x0, 0x0, 0x0}},
+    {-7779, 1, {0x0, 0x0, 0x0}},
+    {-7780, 1, {0x0, 0x0, 0x0}},
+    {-7781, 1, {0x0, 0x0, 0x0}},
+    {-7782, 1, {0x0, 0x0, 0x0}},
+    {-7783, 1, {0x0, 0x0, 0x0}},
+    {-7784, 1, {0x0, 0x0, 0x0}},
+    {-7785, 1, {0x0, 0x0, 0x0}},
+    {-7786, 1, {0x0, 0x0, 0x0}},
+    {-7787, 1, {0x0, 0x0, 0x0}},
+    {-7788, 1, {0x0, 0x0, 0x0}},
+    {-7789, 1, {0x0, 0x0, 0x0}},
+    {-7790, 1, {0x0, 0x0, 0x0}},
+    {-7791, 1, {0x0, 0x0, 0x0}},
+    {-7792, 1, {0x0, 0x0, 0x0}},
+    {-7793, 1, {0x0, 0x0, 0x0}},
+    {-7794, 1, {0x0, 0x0, 0x0}},
+    {-7795, 1, {0x0, 0x0, 0x0}},
+    {-7796, 1, {0x0, 0x0, 0x0}},
+    {-7797, 1, {0x0, 0x0, 0x0}},
+    {-7798, 1, {0x0, 0x0, 0x0}},
+    {-7799, 1, {0x0, 0x0, 0x0}},
+    {-7800, 1, {0x0, 0x0, 0x0}},
+    {-7801, 1, {0x0, 0x0, 0x0}},
+    {-7802, 1, {0x0, 0x0, 0x0}},
+    {-7803, 1, {0x0, 0x0, 0x0}},
+    {-7804, 1, {0x0, 0x0, 0x0}},
+    {-7805, 1, {0x0, 0x0, 0x0}},
+    {-7806, 1, {0x0, 0x0, 0x0}},
+    {-7807, 1, {0x0, 0x0, 0x0}},
+    {-7808, 1, {0x0, 0x0, 0x0}},
+    {-6991, 1, {0x0, 0x0, 0x0}},
+    {-6992, 1, {0x0, 0x0, 0x0}},
+    {-6993, 1, {0x0, 0x0, 0x0}},
+    {-6994, 1, {0x0, 0x0, 0x0}},
+    {-6995, 1, {0x0, 0x0, 0x0}},
+    {-6996, 1, {0x0, 0x0, 0x0}},
+    {-6997, 1, {0x0, 0x0, 0x0}},
+    {-6998, 1, {0x0, 0x0, 0x0}},
+    {-6999, 1, {0x0, 0x0, 0x0}},
+    {-7000, 1, {0x0, 0x0, 0x0}},
+    {-7001, 1, {0x0, 0x0, 0x0}},
+    {-7002, 1, {0x0, 0x0, 0x0}},
+    {-7003, 1, {0x0, 0x0, 0x0}},
+    {-7004, 1, {0x0, 0x0, 0x0}},
+    {-7005, 1, {0x0, 0x0, 0x0}},
+    {-7006, 1, {0x0, 0x0, 0x0}},
+    {-7007, 1, {0x0, 0x0, 0x0}},
+    {-7008, 1, {0x0, 0x0, 0x0}},
+    {-7011, 1, {0x0, 0x0, 0x0}},
+    {-7012, 1, {0x0, 0x0, 0x0}},
+    {-7013, 1, {0x0, 0x0, 0x0}},
+    {-7014, 1, {0x0, 0x0, 0x0}},
+    {-7015, 1, {0x0, 0x0, 0x0}},
+    {-7016, 1, {0x0, 0x0, 0x0}},
+    {-7017, 1, {0x0, 0x0, 0x0}},
+    {-7018, 1, {0x0, 0x0, 0x0}},
+    {-7019, 1, {0x0, 0x0, 0x0}},
+    {-7020, 1, {0x0, 0x0, 0x0}},
+    {-7021, 1, {0x0, 0x0, 0x0}},
+    {-7022, 1, {0x0, 0x0, 0x0}},
+    {-7023, 1, {0x0, 0x0, 0x0}},
+    {-7024, 1, {0x0, 0x0, 0x0}},
+    {-7025, 1, {0x0, 0x0, 0x0}},
+    {-7026, 1, {0x0, 0x0, 0x0}},
+    {-7027, 1, {0x0, 0x0, 0x0}},
+    {-7028, 1, {0x0, 0x0, 0x0}},
+    {-7029, 1, {0x0, 0x0, 0x0}},
+    {-7030, 1, {0x0, 0x0, 0x0}},
+    {-7031, 1, {0x0, 0x0, 0x0}},
+    {-7032, 1, {0x0, 0x0, 0x0}},
+    {-7033, 1, {0x0, 0x0, 0x0}},
+    {-7034, 1, {0x0, 0x0, 0x0}},
+    {-7035, 1, {0x0, 0x0, 0x0}},
+    {-7036, 1, {0x0, 0x0, 0x0}},
+    {-7037, 1, {0x0, 0x0, 0x0}},
+    {-7038, 1, {0x0, 0x0, 0x0}},
+    {-7039, 1, {0x0, 0x0, 0x0}},
+    {-7040, 1, {0x0, 0x0, 0x0}},
+    {-7041, 1, {0x0, 0x0, 0x0}},
+    {-7042, 1, {0x0, 0x0, 0x0}},
+    {-7043, 1, {0x0, 0x0, 0x0}},
+    {-7044, 1, {0x0, 0x0, 0x0}},
+    {-7045, 1, {0x0, 0x0, 0x0}},
+    {-7046, 1, {0x0, 0x0, 0x0}},
+    {-7049, 1, {0x0, 0x0, 0x0}},
+    {-7050, 1, {0x0, 0x0, 0x0}},
+    {-7051, 1, {0x0, 0x0, 0x0}},
+    {-7052, 1, {0x0, 0x0, 0x0}},
+    {-7053, 1, {0x0, 0x0, 0x0}},
+    {-7054, 1, {0x0, 0x0, 0x0}},
+    {-7055, 1, {0x0, 0x0, 0x0}},
+    {-7056, 1, {0x0, 0x0, 0x0}},
+    {-7057, 1, {0x0, 0x0, 0x0}},
+    {-7058, 1, {0x0, 0x0, 0x0}},
+    {-7060, 1, {0x0, 0x0, 0x0}},
+    {-7062, 1, {0x0, 0x0, 0x0}},
+    {-7064, 1, {0x0, 0x0, 0x0}},
+    {-7066, 1, {0x0, 0x0, 0x0}},
+    {-7063, 1, {0x0, 0x0, 0x0}},
+    {-7065, 1, {0x0, 0x0, 0x0}},
+    {-7067, 1, {0x0, 0x0, 0x0}},
+    {-7068, 1, {0x0, 0x0, 0x0}},
+    {-7069, 1, {0x0, 0x0, 0x0}},
+    {-7070, 1, {0x0, 0x0, 0x0}},
+    {-7071, 1, {0x0, 0x0, 0x0}},
+    {-7072, 1, {0x0, 0x0, 0x0}},
+    {-7073, 1, {0x0, 0x0, 0x0}},
+    {-7074, 1, {0x0, 0x0, 0x0}},
+    {-7075, 1, {0x0, 0x0, 0x0}},
+    {-7076, 1, {0x0, 0x0, 0x0}},
+    {-7077, 1, {0x0, 0x0, 0x0}},
+    {-7078, 1, {0x0, 0x0, 0x0}},
+    {-7103, 1, {0x0, 0x0, 0x0}},
+    {-7104, 1, {0x0, 0x0, 0x0}},
+    {-7101, 1, {0x0, 0x0, 0x0}},
+    {-7102, 1, {0x0, 0x0, 0x0}},
+    {-7097, 1, {0x0, 0x0, 0x0}},
+    {-7098, 1, {0x0, 0x0, 0x0}},
+    {-7093, 1, {0x0, 0x0, 0x0}},
+    {-7094, 1, {0x0, 0x0, 0x0}},
+    {-7091, 1, {0x0, 0x0, 0x0}},
+    {-7092, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x3B1, 0x3B9, 0x0}},
+    {0, 2, {0x3B7, 0x3B9, 0x0}},
+    {0, 2, {0x3C9, 0x3B9, 0x0}},
+    {-7167, 1, {0x0, 0x0, 0x0}},
+    {-7168, 1, {0x0, 0x0, 0x0}},
+    {-7173, 1, {0x0, 0x0, 0x0}},
+    {-7175, 1, {0x0, 0x0, 0x0}},
+    {-7176, 1, {0x0, 0x0, 0x0}},
+    {-7177, 1, {0x0, 0x0, 0x0}},
+    {-7178, 1, {0x0, 0x0, 0x0}},
+    {-7961, 1, {0x0, 0x0, 0x0}},
+    {-7183, 1, {0x0, 0x0, 0x0}},
+    {-7187, 1, {0x0, 0x0, 0x0}},
+    {-7188, 1, {0x0, 0x0, 0x0}},
+    {-14, 1, {0x0, 0x0, 0x0}},
+    {-16, 1, {0x0, 0x0, 0x0}},
+    {-7191, 1, {0x0, 0x0, 0x0}},
+    {-7192, 1, {0x0, 0x0, 0x0}},
+    {-7193, 1, {0x0, 0x0, 0x0}},
+    {-7194, 1, {0x0, 0x0, 0x0}},
+    {-7197, 1, {0x0, 0x0, 0x0}},
+    {-7198, 1, {0x0, 0x0, 0x0}},
+    {-7199, 1, {0x0, 0x0, 0x0}},
+    {-7200, 1, {0x0, 0x0, 0x0}},
+    {-7201, 1, {0x0, 0x0, 0x0}},
+    {-7202, 1, {0x0, 0x0, 0x0}},
+    {33, 1, {0x0, 0x0, 0x0}},
+    {-7195, 1, {0x0, 0x0, 0x0}},
+    {-7196, 1, {0x0, 0x0, 0x0}},
+    {-7203, 1, {0x0, 0x0, 0x0}},
+    {-7204, 1, {0x0, 0x0, 0x0}},
+    {-7205, 1, {0x0, 0x0, 0x0}},
+    {-7206, 1, {0x0, 0x0, 0x0}},
+    {-7211, 1, {0x0, 0x0, 0x0}},
+    {-8005, 1, {0x0, 0x0, 0x0}},
+    {-8006, 1, {0x0, 0x0, 0x0}},
+    {-8079, 1, {0x0, 0x0, 0x0}},
+    {-7213, 1, {0x0, 0x0, 0x0}},
+    {-7225, 1, {0x0, 0x0, 0x0}},
+    {-7226, 1, {0x0, 0x0, 0x0}},
+    {-7217, 1, {0x0, 0x0, 0x0}},
+    {-7218, 1, {0x0, 0x0, 0x0}},
+    {-8009, 1, {0x0, 0x0, 0x0}},
+    {-8351, 1, {0x0, 0x0, 0x0}},
+    {-8355, 1, {0x0, 0x0, 0x0}},
+    {-8356, 1, {0x0, 0x0, 0x0}},
+    {-8357, 1, {0x0, 0x0, 0x0}},
+    {-8358, 1, {0x0, 0x0, 0x0}},
+    {-8168, 1, {0x0, 0x0, 0x0}},
+    {-8359, 1, {0x0, 0x0, 0x0}},
+    {-8360, 1, {0x0, 0x0, 0x0}},
+    {-8361, 1, {0x0, 0x0, 0x0}},
+    {-8362, 1, {0x0, 0x0, 0x0}},
+    {-8363, 1, {0x0, 0x0, 0x0}},
+    {-7517, 1, {0x0, 0x0, 0x0}},
+    {-8366, 1, {0x0, 0x0, 0x0}},
+    {-8383, 1, {0x0, 0x0, 0x0}},
+    {-8394, 1, {0x0, 0x0, 0x0}},
+    {-8395, 1, {0x0, 0x0, 0x0}},
+    {28, 1, {0x0, 0x0, 0x0}},
+    {-8390, 1, {0x0, 0x0, 0x0}},
+    {-8389, 1, {0x0, 0x0, 0x0}},
+    {-8400, 1, {0x0, 0x0, 0x0}},
+    {-7548, 1, {0x0, 0x0, 0x0}},
+    {-7562, 1, {0x0, 0x0, 0x0}},
+    {-7563, 1, {0x0, 0x0, 0x0}},
+    {-7551, 1, {0x0, 0x0, 0x0}},
+    {-8417, 1, {0x0, 0x0, 0x0}},
+    {-8418, 1, {0x0, 0x0, 0x0}},
+    {-8415, 1, {0x0, 0x0, 0x0}},
+    {16, 1, {0x0, 0x0, 0x0}},
+    {-10, 1, {0x0, 0x0, 0x0}},
+    {-9, 1, {0x0, 0x0, 0x0}},
+    {-26, 1, {0x0, 0x0, 0x0}},
+    {3, 1, {0x0, 0x0, 0x0}},
+    {6, 1, {0x0, 0x0, 0x0}},
+    {-8739, 1, {0x0, 0x0, 0x0}},
+    {-8754, 1, {0x0, 0x0, 0x0}},
+    {-8753, 1, {0x0, 0x0, 0x0}},
+    {-12, 1, {0x0, 0x0, 0x0}},
+    {-4, 1, {0x0, 0x0, 0x0}},
+    {-81, 1, {0x0, 0x0, 0x0}},
+    {3295, 1, {0x0, 0x0, 0x0}},
+    {-9263, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x31, 0x30, 0x0}},
+    {0, 2, {0x31, 0x31, 0x0}},
+    {0, 2, {0x31, 0x32, 0x0}},
+    {0, 2, {0x31, 0x33, 0x0}},
+    {0, 2, {0x31, 0x34, 0x0}},
+    {0, 2, {0x31, 0x35, 0x0}},
+    {0, 2, {0x31, 0x36, 0x0}},
+    {0, 2, {0x31, 0x37, 0x0}},
+    {0, 2, {0x31, 0x38, 0x0}},
+    {0, 2, {0x31, 0x39, 0x0}},
+    {0, 2, {0x32, 0x30, 0x0}},
+    {-9301, 1, {0x0, 0x0, 0x0}},
+    {-9327, 1, {0x0, 0x0, 0x0}},
+    {-9402, 1, {0x0, 0x0, 0x0}},
+    {-10743, 1, {0x0, 0x0, 0x0}},
+    {-3814, 1, {0x0, 0x0, 0x0}},
+    {-10727, 1, {0x0, 0x0, 0x0}},
+    {-10780, 1, {0x0, 0x0, 0x0}},
+    {-10749, 1, {0x0, 0x0, 0x0}},
+    {-10783, 1, {0x0, 0x0, 0x0}},
+    {-10782, 1, {0x0, 0x0, 0x0}},
+    {-10815, 1, {0x0, 0x0, 0x0}},
+    {-12256, 1, {0x0, 0x0, 0x0}},
+    {8971, 1, {0x0, 0x0, 0x0}},
+    {11319, 1, {0x0, 0x0, 0x0}},
+    {13121, 1, {0x0, 0x0, 0x0}},
+    {18760, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x32, 0x31, 0x0}},
+    {0, 2, {0x32, 0x32, 0x0}},
+    {0, 2, {0x32, 0x33, 0x0}},
+    {0, 2, {0x32, 0x34, 0x0}},
+    {0, 2, {0x32, 0x35, 0x0}},
+    {0, 2, {0x32, 0x36, 0x0}},
+    {0, 2, {0x32, 0x37, 0x0}},
+    {0, 2, {0x32, 0x38, 0x0}},
+    {0, 2, {0x32, 0x39, 0x0}},
+    {0, 2, {0x33, 0x30, 0x0}},
+    {0, 2, {0x33, 0x31, 0x0}},
+    {0, 2, {0x33, 0x32, 0x0}},
+    {0, 2, {0x33, 0x33, 0x0}},
+    {0, 2, {0x33, 0x34, 0x0}},
+    {0, 2, {0x33, 0x35, 0x0}},
+    {-8544, 1, {0x0, 0x0, 0x0}},
+    {-8543, 1, {0x0, 0x0, 0x0}},
+    {-8542, 1, {0x0, 0x0, 0x0}},
+    {-8541, 1, {0x0, 0x0, 0x0}},
+    {-8540, 1, {0x0, 0x0, 0x0}},
+    {-8539, 1, {0x0, 0x0, 0x0}},
+    {31122, 1, {0x0, 0x0, 0x0}},
+    {32297, 1, {0x0, 0x0, 0x0}},
+    {32884, 1, {0x0, 0x0, 0x0}},
+    {34059, 1, {0x0, 0x0, 0x0}},
+    {34646, 1, {0x0, 0x0, 0x0}},
+    {35233, 1, {0x0, 0x0, 0x0}},
+    {36408, 1, {0x0, 0x0, 0x0}},
+    {37583, 1, {0x0, 0x0, 0x0}},
+    {38170, 1, {0x0, 0x0, 0x0}},
+    {39345, 1, {0x0, 0x0, 0x0}},
+    {39932, 1, {0x0, 0x0, 0x0}},
+    {40519, 1, {0x0, 0x0, 0x0}},
+    {41106, 1, {0x0, 0x0, 0x0}},
+    {41693, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0xCC38, 0xACE0, 0x0}},
+    {0, 2, {0xC8FC, 0xC758, 0x0}},
+    {37938, 1, {0x0, 0x0, 0x0}},
+    {7040, 1, {0x0, 0x0, 0x0}},
+    {7179, 1, {0x0, 0x0, 0x0}},
+    {7047, 1, {0x0, 0x0, 0x0}},
+    {9304, 1, {0x0, 0x0, 0x0}},
+    {7184, 1, {0x0, 0x0, 0x0}},
+    {7912, 1, {0x0, 0x0, 0x0}},
+    {7037, 1, {0x0, 0x0, 0x0}},
+    {7908, 1, {0x0, 0x0, 0x0}},
+    {7125, 1, {0x0, 0x0, 0x0}},
+    {8376, 1, {0x0, 0x0, 0x0}},
+    {13438, 1, {0x0, 0x0, 0x0}},
+    {15840, 1, {0x0, 0x0, 0x0}},
+    {14760, 1, {0x0, 0x0, 0x0}},
+    {13467, 1, {0x0, 0x0, 0x0}},
+    {24387, 1, {0x0, 0x0, 0x0}},
+    {9360, 1, {0x0, 0x0, 0x0}},
+    {13141, 1, {0x0, 0x0, 0x0}},
+    {13721, 1, {0x0, 0x0, 0x0}},
+    {13431, 1, {0x0, 0x0, 0x0}},
+    {18091, 1, {0x0, 0x0, 0x0}},
+    {8569, 1, {0x0, 0x0, 0x0}},
+    {16356, 1, {0x0, 0x0, 0x0}},
+    {23051, 1, {0x0, 0x0, 0x0}},
+    {18118, 1, {0x0, 0x0, 0x0}},
+    {8220, 1, {0x0, 0x0, 0x0}},
+    {18239, 1, {0x0, 0x0, 0x0}},
+    {17053, 1, {0x0, 0x0, 0x0}},
+    {9944, 1, {0x0, 0x0, 0x0}},
+    {24013, 1, {0x0, 0x0, 0x0}},
+    {7821, 1, {0x0, 0x0, 0x0}},
+    {8402, 1, {0x0, 0x0, 0x0}},
+    {14921, 1, {0x0, 0x0, 0x0}},
+    {25957, 1, {0x0, 0x0, 0x0}},
+    {7280, 1, {0x0, 0x0, 0x0}},
+    {7927, 1, {0x0, 0x0, 0x0}},
+    {14528, 1, {0x0, 0x0, 0x0}},
+    {7014, 1, {0x0, 0x0, 0x0}},
+    {7048, 1, {0x0, 0x0, 0x0}},
+    {7013, 1, {0x0, 0x0, 0x0}},
+    {11071, 1, {0x0, 0x0, 0x0}},
+    {8523, 1, {0x0, 0x0, 0x0}},
+    {8338, 1, {0x0, 0x0, 0x0}},
+    {10477, 1, {0x0, 0x0, 0x0}},
+    {10427, 1, {0x0, 0x0, 0x0}},
+    {17463, 1, {0x0, 0x0, 0x0}},
+    {7252, 1, {0x0, 0x0, 0x0}},
+    {23065, 1, {0x0, 0x0, 0x0}},
+    {8357, 1, {0x0, 0x0, 0x0}},
+    {9836, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x33, 0x36, 0x0}},
+    {0, 2, {0x33, 0x37, 0x0}},
+    {0, 2, {0x33, 0x38, 0x0}},
+    {0, 2, {0x33, 0x39, 0x0}},
+    {0, 2, {0x34, 0x30, 0x0}},
+    {0, 2, {0x34, 0x31, 0x0}},
+    {0, 2, {0x34, 0x32, 0x0}},
+    {0, 2, {0x34, 0x33, 0x0}},
+    {0, 2, {0x34, 0x34, 0x0}},
+    {0, 2, {0x34, 0x35, 0x0}},
+    {0, 2, {0x34, 0x36, 0x0}},
+    {0, 2, {0x34, 0x37, 0x0}},
+    {0, 2, {0x34, 0x38, 0x0}},
+    {0, 2, {0x34, 0x39, 0x0}},
+    {0, 2, {0x35, 0x30, 0x0}},
+    {-558, 1, {0x0, 0x0, 0x0}},
+    {-557, 1, {0x0, 0x0, 0x0}},
+    {-556, 1, {0x0, 0x0, 0x0}},
+    {-555, 1, {0x0, 0x0, 0x0}},
+    {-554, 1, {0x0, 0x0, 0x0}},
+    {-553, 1, {0x0, 0x0, 0x0}},
+    {-552, 1, {0x0, 0x0, 0x0}},
+    {-551, 1, {0x0, 0x0, 0x0}},
+    {-550, 1, {0x0, 0x0, 0x0}},
+    {-549, 1, {0x0, 0x0, 0x0}},
+    {-548, 1, {0x0, 0x0, 0x0}},
+    {-547, 1, {0x0, 0x0, 0x0}},
+    {-546, 1, {0x0, 0x0, 0x0}},
+    {-545, 1, {0x0, 0x0, 0x0}},
+    {-544, 1, {0x0, 0x0, 0x0}},
+    {-543, 1, {0x0, 0x0, 0x0}},
+    {-541, 1, {0x0, 0x0, 0x0}},
+    {-540, 1, {0x0, 0x0, 0x0}},
+    {-539, 1, {0x0, 0x0, 0x0}},
+    {-538, 1, {0x0, 0x0, 0x0}},
+    {-536, 1, {0x0, 0x0, 0x0}},
+    {-534, 1, {0x0, 0x0, 0x0}},
+    {-532, 1, {0x0, 0x0, 0x0}},
+    {-530, 1, {0x0, 0x0, 0x0}},
+    {-528, 1, {0x0, 0x0, 0x0}},
+    {-527, 1, {0x0, 0x0, 0x0}},
+    {-526, 1, {0x0, 0x0, 0x0}},
+    {-525, 1, {0x0, 0x0, 0x0}},
+    {-524, 1, {0x0, 0x0, 0x0}},
+    {-35332, 1, {0x0, 0x0, 0x0}},
+    {-42280, 1, {0x0, 0x0, 0x0}},
+    {-42308, 1, {0x0, 0x0, 0x0}},
+    {-42319, 1, {0x0, 0x0, 0x0}},
+    {-42315, 1, {0x0, 0x0, 0x0}},
+    {-42305, 1, {0x0, 0x0, 0x0}},
+    {-42258, 1, {0x0, 0x0, 0x0}},
+    {-42282, 1, {0x0, 0x0, 0x0}},
+    {-42261, 1, {0x0, 0x0, 0x0}},
+    {928, 1, {0x0, 0x0, 0x0}},
+    {-42307, 1, {0x0, 0x0, 0x0}},
+    {-35384, 1, {0x0, 0x0, 0x0}},
+    {-38864, 1, {0x0, 0x0, 0x0}},
+    {-27832, 1, {0x0, 0x0, 0x0}},
+    {-37389, 1, {0x0, 0x0, 0x0}},
+    {-27192, 1, {0x0, 0x0, 0x0}},
+    {-27707, 1, {0x0, 0x0, 0x0}},
+    {-35379, 1, {0x0, 0x0, 0x0}},
+    {-43731, 1, {0x0, 0x0, 0x0}},
+    {-42273, 1, {0x0, 0x0, 0x0}},
+    {-22891, 1, {0x0, 0x0, 0x0}},
+    {-22892, 1, {0x0, 0x0, 0x0}},
+    {-40888, 1, {0x0, 0x0, 0x0}},
+    {-26425, 1, {0x0, 0x0, 0x0}},
+    {-41860, 1, {0x0, 0x0, 0x0}},
+    {-40900, 1, {0x0, 0x0, 0x0}},
+    {-38679, 1, {0x0, 0x0, 0x0}},
+    {-33445, 1, {0x0, 0x0, 0x0}},
+    {-31114, 1, {0x0, 0x0, 0x0}},
+    {-29393, 1, {0x0, 0x0, 0x0}},
+    {-29015, 1, {0x0, 0x0, 0x0}},
+    {-28698, 1, {0x0, 0x0, 0x0}},
+    {-26756, 1, {0x0, 0x0, 0x0}},
+    {-36626, 1, {0x0, 0x0, 0x0}},
+    {-35834, 1, {0x0, 0x0, 0x0}},
+    {-34877, 1, {0x0, 0x0, 0x0}},
+    {-34105, 1, {0x0, 0x0, 0x0}},
+    {-29915, 1, {0x0, 0x0, 0x0}},
+    {-26543, 1, {0x0, 0x0, 0x0}},
+    {-24361, 1, {0x0, 0x0, 0x0}},
+    {-43673, 1, {0x0, 0x0, 0x0}},
+    {-42407, 1, {0x0, 0x0, 0x0}},
+    {-36377, 1, {0x0, 0x0, 0x0}},
+    {-34563, 1, {0x0, 0x0, 0x0}},
+    {-29426, 1, {0x0, 0x0, 0x0}},
+    {-23298, 1, {0x0, 0x0, 0x0}},
+    {-39889, 1, {0x0, 0x0, 0x0}},
+    {-35127, 1, {0x0, 0x0, 0x0}},
+    {-29526, 1, {0x0, 0x0, 0x0}},
+    {-28608, 1, {0x0, 0x0, 0x0}},
+    {-38492, 1, {0x0, 0x0, 0x0}},
+    {-30542, 1, {0x0, 0x0, 0x0}},
+    {-28936, 1, {0x0, 0x0, 0x0}},
+    {-39518, 1, {0x0, 0x0, 0x0}},
+    {-37394, 1, {0x0, 0x0, 0x0}},
+    {-35776, 1, {0x0, 0x0, 0x0}},
+    {-34351, 1, {0x0, 0x0, 0x0}},
+    {-26718, 1, {0x0, 0x0, 0x0}},
+    {-43431, 1, {0x0, 0x0, 0x0}},
+    {-42871, 1, {0x0, 0x0, 0x0}},
+    {-42577, 1, {0x0, 0x0, 0x0}},
+    {-37996, 1, {0x0, 0x0, 0x0}},
+    {-36446, 1, {0x0, 0x0, 0x0}},
+    {-34594, 1, {0x0, 0x0, 0x0}},
+    {-33356, 1, {0x0, 0x0, 0x0}},
+    {-31027, 1, {0x0, 0x0, 0x0}},
+    {-29487, 1, {0x0, 0x0, 0x0}},
+    {-29402, 1, {0x0, 0x0, 0x0}},
+    {-27464, 1, {0x0, 0x0, 0x0}},
+    {-25094, 1, {0x0, 0x0, 0x0}},
+    {-24010, 1, {0x0, 0x0, 0x0}},
+    {-23360, 1, {0x0, 0x0, 0x0}},
+    {-32943, 1, {0x0, 0x0, 0x0}},
+    {-32701, 1, {0x0, 0x0, 0x0}},
+    {-31645, 1, {0x0, 0x0, 0x0}},
+    {-30069, 1, {0x0, 0x0, 0x0}},
+    {-26171, 1, {0x0, 0x0, 0x0}},
+    {-23233, 1, {0x0, 0x0, 0x0}},
+    {-28267, 1, {0x0, 0x0, 0x0}},
+    {-41059, 1, {0x0, 0x0, 0x0}},
+    {-39487, 1, {0x0, 0x0, 0x0}},
+    {-31972, 1, {0x0, 0x0, 0x0}},
+    {-30919, 1, {0x0, 0x0, 0x0}},
+    {-34532, 1, {0x0, 0x0, 0x0}},
+    {-32893, 1, {0x0, 0x0, 0x0}},
+    {-27782, 1, {0x0, 0x0, 0x0}},
+    {-25170, 1, {0x0, 0x0, 0x0}},
+    {-41074, 1, {0x0, 0x0, 0x0}},
+    {-40169, 1, {0x0, 0x0, 0x0}},
+    {-36665, 1, {0x0, 0x0, 0x0}},
+    {-35699, 1, {0x0, 0x0, 0x0}},
+    {-35391, 1, {0x0, 0x0, 0x0}},
+    {-31776, 1, {0x0, 0x0, 0x0}},
+    {-31513, 1, {0x0, 0x0, 0x0}},
+    {-25350, 1, {0x0, 0x0, 0x0}},
+    {-42624, 1, {0x0, 0x0, 0x0}},
+    {-30920, 1, {0x0, 0x0, 0x0}},
+    {-42872, 1, {0x0, 0x0, 0x0}},
+    {-42889, 1, {0x0, 0x0, 0x0}},
+    {-32570, 1, {0x0, 0x0, 0x0}},
+    {-31641, 1, {0x0, 0x0, 0x0}},
+    {-30055, 1, {0x0, 0x0, 0x0}},
+    {-25316, 1, {0x0, 0x0, 0x0}},
+    {-28122, 1, {0x0, 0x0, 0x0}},
+    {-38540, 1, {0x0, 0x0, 0x0}},
+    {-36698, 1, {0x0, 0x0, 0x0}},
+    {-28255, 1, {0x0, 0x0, 0x0}},
+    {-43813, 1, {0x0, 0x0, 0x0}},
+    {-40312, 1, {0x0, 0x0, 0x0}},
+    {-39246, 1, {0x0, 0x0, 0x0}},
+    {-34266, 1, {0x0, 0x0, 0x0}},
+    {-33778, 1, {0x0, 0x0, 0x0}},
+    {-42572, 1, {0x0, 0x0, 0x0}},
+    {-32873, 1, {0x0, 0x0, 0x0}},
+    {-43430, 1, {0x0, 0x0, 0x0}},
+    {-39357, 1, {0x0, 0x0, 0x0}},
+    {-43866, 1, {0x0, 0x0, 0x0}},
+    {-35996, 1, {0x0, 0x0, 0x0}},
+    {-37873, 1, {0x0, 0x0, 0x0}},
+    {-31816, 1, {0x0, 0x0, 0x0}},
+    {-42408, 1, {0x0, 0x0, 0x0}},
+    {-41230, 1, {0x0, 0x0, 0x0}},
+    {-33388, 1, {0x0, 0x0, 0x0}},
+    {-29989, 1, {0x0, 0x0, 0x0}},
+    {-28357, 1, {0x0, 0x0, 0x0}},
+    {-36278, 1, {0x0, 0x0, 0x0}},
+    {-27073, 1, {0x0, 0x0, 0x0}},
+    {-36074, 1, {0x0, 0x0, 0x0}},
+    {-38517, 1, {0x0, 0x0, 0x0}},
+    {-30351, 1, {0x0, 0x0, 0x0}},
+    {-38357, 1, {0x0, 0x0, 0x0}},
+    {-33809, 1, {0x0, 0x0, 0x0}},
+    {-43721, 1, {0x0, 0x0, 0x0}},
+    {-43023, 1, {0x0, 0x0, 0x0}},
+    {-42928, 1, {0x0, 0x0, 0x0}},
+    {-37113, 1, {0x0, 0x0, 0x0}},
+    {-31892, 1, {0x0, 0x0, 0x0}},
+    {-30477, 1, {0x0, 0x0, 0x0}},
+    {-28331, 1, {0x0, 0x0, 0x0}},
+    {-42634, 1, {0x0, 0x0, 0x0}},
+    {-42302, 1, {0x0, 0x0, 0x0}},
+    {-40974, 1, {0x0, 0x0, 0x0}},
+    {-39574, 1, {0x0, 0x0, 0x0}},
+    {-37822, 1, {0x0, 0x0, 0x0}},
+    {-35206, 1, {0x0, 0x0, 0x0}},
+    {-32859, 1, {0x0, 0x0, 0x0}},
+    {-25561, 1, {0x0, 0x0, 0x0}},
+    {-24349, 1, {0x0, 0x0, 0x0}},
+    {-23281, 1, {0x0, 0x0, 0x0}},
+    {-23227, 1, {0x0, 0x0, 0x0}},
+    {-42735, 1, {0x0, 0x0, 0x0}},
+    {-37573, 1, {0x0, 0x0, 0x0}},
+    {-36373, 1, {0x0, 0x0, 0x0}},
+    {-27179, 1, {0x0, 0x0, 0x0}},
+    {-39706, 1, {0x0, 0x0, 0x0}},
+    {-38911, 1, {0x0, 0x0, 0x0}},
+    {-38800, 1, {0x0, 0x0, 0x0}},
+    {-38135, 1, {0x0, 0x0, 0x0}},
+    {-35439, 1, {0x0, 0x0, 0x0}},
+    {-34890, 1, {0x0, 0x0, 0x0}},
+    {-34059, 1, {0x0, 0x0, 0x0}},
+    {-32715, 1, {0x0, 0x0, 0x0}},
+    {-31650, 1, {0x0, 0x0, 0x0}},
+    {-31016, 1, {0x0, 0x0, 0x0}},
+    {-27250, 1, {0x0, 0x0, 0x0}},
+    {-29867, 1, {0x0, 0x0, 0x0}},
+    {-26999, 1, {0x0, 0x0, 0x0}},
+    {-26193, 1, {0x0, 0x0, 0x0}},
+    {-42885, 1, {0x0, 0x0, 0x0}},
+    {-42746, 1, {0x0, 0x0, 0x0}},
+    {-42209, 1, {0x0, 0x0, 0x0}},
+    {-35031, 1, {0x0, 0x0, 0x0}},
+    {-28894, 1, {0x0, 0x0, 0x0}},
+    {-28407, 1, {0x0, 0x0, 0x0}},
+    {-39641, 1, {0x0, 0x0, 0x0}},
+    {-39342, 1, {0x0, 0x0, 0x0}},
+    {-38441, 1, {0x0, 0x0, 0x0}},
+    {-36343, 1, {0x0, 0x0, 0x0}},
+    {-32104, 1, {0x0, 0x0, 0x0}},
+    {-34354, 1, {0x0, 0x0, 0x0}},
+    {-43716, 1, {0x0, 0x0, 0x0}},
+    {-41648, 1, {0x0, 0x0, 0x0}},
+    {-40387, 1, {0x0, 0x0, 0x0}},
+    {-39921, 1, {0x0, 0x0, 0x0}},
+    {-39312, 1, {0x0, 0x0, 0x0}},
+    {-34299, 1, {0x0, 0x0, 0x0}},
+    {-34117, 1, {0x0, 0x0, 0x0}},
+    {-31253, 1, {0x0, 0x0, 0x0}},
+    {-31082, 1, {0x0, 0x0, 0x0}},
+    {-26493, 1, {0x0, 0x0, 0x0}},
+    {-25276, 1, {0x0, 0x0, 0x0}},
+    {-25195, 1, {0x0, 0x0, 0x0}},
+    {-24988, 1, {0x0, 0x0, 0x0}},
+    {-43562, 1, {0x0, 0x0, 0x0}},
+    {-32776, 1, {0x0, 0x0, 0x0}},
+    {-26627, 1, {0x0, 0x0, 0x0}},
+    {-25344, 1, {0x0, 0x0, 0x0}},
+    {-39128, 1, {0x0, 0x0, 0x0}},
+    {-43828, 1, {0x0, 0x0, 0x0}},
+    {-43233, 1, {0x0, 0x0, 0x0}},
+    {-40398, 1, {0x0, 0x0, 0x0}},
+    {-40318, 1, {0x0, 0x0, 0x0}},
+    {-37925, 1, {0x0, 0x0, 0x0}},
+    {-36797, 1, {0x0, 0x0, 0x0}},
+    {-34802, 1, {0x0, 0x0, 0x0}},
+    {-33663, 1, {0x0, 0x0, 0x0}},
+    {-29894, 1, {0x0, 0x0, 0x0}},
+    {-26951, 1, {0x0, 0x0, 0x0}},
+    {-23095, 1, {0x0, 0x0, 0x0}},
+    {-37693, 1, {0x0, 0x0, 0x0}},
+    {-25496, 1, {0x0, 0x0, 0x0}},
+    {-42814, 1, {0x0, 0x0, 0x0}},
+    {-37453, 1, {0x0, 0x0, 0x0}},
+    {-37334, 1, {0x0, 0x0, 0x0}},
+    {-35977, 1, {0x0, 0x0, 0x0}},
+    {-35631, 1, {0x0, 0x0, 0x0}},
+    {-34243, 1, {0x0, 0x0, 0x0}},
+    {-33908, 1, {0x0, 0x0, 0x0}},
+    {-33123, 1, {0x0, 0x0, 0x0}},
+    {-31935, 1, {0x0, 0x0, 0x0}},
+    {-24946, 1, {0x0, 0x0, 0x0}},
+    {-43108, 1, {0x0, 0x0, 0x0}},
+    {-38820, 1, {0x0, 0x0, 0x0}},
+    {-25435, 1, {0x0, 0x0, 0x0}},
+    {-43433, 1, {0x0, 0x0, 0x0}},
+    {-40124, 1, {0x0, 0x0, 0x0}},
+    {-35820, 1, {0x0, 0x0, 0x0}},
+    {-27309, 1, {0x0, 0x0, 0x0}},
+    {-39501, 1, {0x0, 0x0, 0x0}},
+    {-39061, 1, {0x0, 0x0, 0x0}},
+    {-37315, 1, {0x0, 0x0, 0x0}},
+    {-34388, 1, {0x0, 0x0, 0x0}},
+    {-25430, 1, {0x0, 0x0, 0x0}},
+    {-42932, 1, {0x0, 0x0, 0x0}},
+    {-42447, 1, {0x0, 0x0, 0x0}},
+    {-40314, 1, {0x0, 0x0, 0x0}},
+    {-37837, 1, {0x0, 0x0, 0x0}},
+    {-37523, 1, {0x0, 0x0, 0x0}},
+    {-37178, 1, {0x0, 0x0, 0x0}},
+    {-36094, 1, {0x0, 0x0, 0x0}},
+    {-34270, 1, {0x0, 0x0, 0x0}},
+    {-33795, 1, {0x0, 0x0, 0x0}},
+    {-31341, 1, {0x0, 0x0, 0x0}},
+    {-28952, 1, {0x0, 0x0, 0x0}},
+    {-28935, 1, {0x0, 0x0, 0x0}},
+    {-26653, 1, {0x0, 0x0, 0x0}},
+    {-25352, 1, {0x0, 0x0, 0x0}},
+    {-42668, 1, {0x0, 0x0, 0x0}},
+    {-35634, 1, {0x0, 0x0, 0x0}},
+    {-42448, 1, {0x0, 0x0, 0x0}},
+    {-34846, 1, {0x0, 0x0, 0x0}},
+    {-34135, 1, {0x0, 0x0, 0x0}},
+    {-29686, 1, {0x0, 0x0, 0x0}},
+    {-25422, 1, {0x0, 0x0, 0x0}},
+    {-23963, 1, {0x0, 0x0, 0x0}},
+    {-23380, 1, {0x0, 0x0, 0x0}},
+    {-37469, 1, {0x0, 0x0, 0x0}},
+    {-35882, 1, {0x0, 0x0, 0x0}},
+    {-30734, 1, {0x0, 0x0, 0x0}},
+    {-32556, 1, {0x0, 0x0, 0x0}},
+    {-32472, 1, {0x0, 0x0, 0x0}},
+    {-32103, 1, {0x0, 0x0, 0x0}},
+    {-34618, 1, {0x0, 0x0, 0x0}},
+    {-35170, 1, {0x0, 0x0, 0x0}},
+    {-28324, 1, {0x0, 0x0, 0x0}},
+    {-43837, 1, {0x0, 0x0, 0x0}},
+    {-30408, 1, {0x0, 0x0, 0x0}},
+    {-42949, 1, {0x0, 0x0, 0x0}},
+    {-43001, 1, {0x0, 0x0, 0x0}},
+    {-39771, 1, {0x0, 0x0, 0x0}},
+    {-38703, 1, {0x0, 0x0, 0x0}},
+    {-32045, 1, {0x0, 0x0, 0x0}},
+    {-40575, 1, {0x0, 0x0, 0x0}},
+    {-36071, 1, {0x0, 0x0, 0x0}},
+    {-37714, 1, {0x0, 0x0, 0x0}},
+    {-27340, 1, {0x0, 0x0, 0x0}},
+    {-29116, 1, {0x0, 0x0, 0x0}},
+    {-25532, 1, {0x0, 0x0, 0x0}},
+    {-28799, 1, {0x0, 0x0, 0x0}},
+    {-39736, 1, {0x0, 0x0, 0x0}},
+    {-43212, 1, {0x0, 0x0, 0x0}},
+    {-42061, 1, {0x0, 0x0, 0x0}},
+    {-41398, 1, {0x0, 0x0, 0x0}},
+    {-37790, 1, {0x0, 0x0, 0x0}},
+    {-43063, 1, {0x0, 0x0, 0x0}},
+    {-34540, 1, {0x0, 0x0, 0x0}},
+    {-33613, 1, {0x0, 0x0, 0x0}},
+    {-32988, 1, {0x0, 0x0, 0x0}},
+    {-32955, 1, {0x0, 0x0, 0x0}},
+    {-32949, 1, {0x0, 0x0, 0x0}},
+    {-32908, 1, {0x0, 0x0, 0x0}},
+    {-25286, 1, {0x0, 0x0, 0x0}},
+    {-32095, 1, {0x0, 0x0, 0x0}},
+    {-31329, 1, {0x0, 0x0, 0x0}},
+    {-29710, 1, {0x0, 0x0, 0x0}},
+    {-28458, 1, {0x0, 0x0, 0x0}},
+    {-27117, 1, {0x0, 0x0, 0x0}},
+    {-26921, 1, {0x0, 0x0, 0x0}},
+    {-24891, 1, {0x0, 0x0, 0x0}},
+    {-24879, 1, {0x0, 0x0, 0x0}},
+    {-24836, 1, {0x0, 0x0, 0x0}},
+    {-23673, 1, {0x0, 0x0, 0x0}},
+    {-26960, 1, {0x0, 0x0, 0x0}},
+    {-25464, 1, {0x0, 0x0, 0x0}},
+    {-43650, 1, {0x0, 0x0, 0x0}},
+    {-43338, 1, {0x0, 0x0, 0x0}},
+    {-43237, 1, {0x0, 0x0, 0x0}},
+    {-42858, 1, {0x0, 0x0, 0x0}},
+    {-42832, 1, {0x0, 0x0, 0x0}},
+    {-42724, 1, {0x0, 0x0, 0x0}},
+    {-42137, 1, {0x0, 0x0, 0x0}},
+    {-42033, 1, {0x0, 0x0, 0x0}},
+    {-41936, 1, {0x0, 0x0, 0x0}},
+    {-41465, 1, {0x0, 0x0, 0x0}},
+    {-41362, 1, {0x0, 0x0, 0x0}},
+    {-40407, 1, {0x0, 0x0, 0x0}},
+    {-39337, 1, {0x0, 0x0, 0x0}},
+    {-39126, 1, {0x0, 0x0, 0x0}},
+    {-39089, 1, {0x0, 0x0, 0x0}},
+    {-38990, 1, {0x0, 0x0, 0x0}},
+    {-38130, 1, {0x0, 0x0, 0x0}},
+    {-37984, 1, {0x0, 0x0, 0x0}},
+    {-37810, 1, {0x0, 0x0, 0x0}},
+    {-37311, 1, {0x0, 0x0, 0x0}},
+    {-36046, 1, {0x0, 0x0, 0x0}},
+    {-35884, 1, {0x0, 0x0, 0x0}},
+    {-35621, 1, {0x0, 0x0, 0x0}},
+    {-35034, 1, {0x0, 0x0, 0x0}},
+    {-34344, 1, {0x0, 0x0, 0x0}},
+    {-33210, 1, {0x0, 0x0, 0x0}},
+    {-33038, 1, {0x0, 0x0, 0x0}},
+    {-33028, 1, {0x0, 0x0, 0x0}},
+    {-33030, 1, {0x0, 0x0, 0x0}},
+    {-33023, 1, {0x0, 0x0, 0x0}},
+    {-33018, 1, {0x0, 0x0, 0x0}},
+    {-33012, 1, {0x0, 0x0, 0x0}},
+    {-32965, 1, {0x0, 0x0, 0x0}},
+    {-32788, 1, {0x0, 0x0, 0x0}},
+    {-32724, 1, {0x0, 0x0, 0x0}},
+    {-32406, 1, {0x0, 0x0, 0x0}},
+    {-31843, 1, {0x0, 0x0, 0x0}},
+    {-31823, 1, {0x0, 0x0, 0x0}},
+    {-31768, 1, {0x0, 0x0, 0x0}},
+    {-31464, 1, {0x0, 0x0, 0x0}},
+    {-31318, 1, {0x0, 0x0, 0x0}},
+    {-30831, 1, {0x0, 0x0, 0x0}},
+    {-30692, 1, {0x0, 0x0, 0x0}},
+    {-30693, 1, {0x0, 0x0, 0x0}},
+    {-30216, 1, {0x0, 0x0, 0x0}},
+    {-29008, 1, {0x0, 0x0, 0x0}},
+    {-28875, 1, {0x0, 0x0, 0x0}},
+    {-28513, 1, {0x0, 0x0, 0x0}},
+    {-28049, 1, {0x0, 0x0, 0x0}},
+    {-27997, 1, {0x0, 0x0, 0x0}},
+    {-27312, 1, {0x0, 0x0, 0x0}},
+    {-27183, 1, {0x0, 0x0, 0x0}},
+    {-25477, 1, {0x0, 0x0, 0x0}},
+    {-25194, 1, {0x0, 0x0, 0x0}},
+    {-25135, 1, {0x0, 0x0, 0x0}},
+    {-39414, 1, {0x0, 0x0, 0x0}},
+    {84098, 1, {0x0, 0x0, 0x0}},
+    {-30805, 1, {0x0, 0x0, 0x0}},
+    {-44106, 1, {0x0, 0x0, 0x0}},
+    {-43196, 1, {0x0, 0x0, 0x0}},
+    {-43274, 1, {0x0, 0x0, 0x0}},
+    {-43763, 1, {0x0, 0x0, 0x0}},
+    {-43311, 1, {0x0, 0x0, 0x0}},
+    {-43253, 1, {0x0, 0x0, 0x0}},
+    {-42927, 1, {0x0, 0x0, 0x0}},
+    {-42877, 1, {0x0, 0x0, 0x0}},
+    {-42203, 1, {0x0, 0x0, 0x0}},
+    {-42276, 1, {0x0, 0x0, 0x0}},
+    {-41506, 1, {0x0, 0x0, 0x0}},
+    {-41418, 1, {0x0, 0x0, 0x0}},
+    {-41274, 1, {0x0, 0x0, 0x0}},
+    {-41259, 1, {0x0, 0x0, 0x0}},
+    {-40990, 1, {0x0, 0x0, 0x0}},
+    {-40793, 1, {0x0, 0x0, 0x0}},
+    {-39856, 1, {0x0, 0x0, 0x0}},
+    {-39850, 1, {0x0, 0x0, 0x0}},
+    {-39707, 1, {0x0, 0x0, 0x0}},
+    {-39640, 1, {0x0, 0x0, 0x0}},
+    {-39225, 1, {0x0, 0x0, 0x0}},
+    {-39296, 1, {0x0, 0x0, 0x0}},
+    {-39163, 1, {0x0, 0x0, 0x0}},
+    {-39210, 1, {0x0, 0x0, 0x0}},
+    {-39065, 1, {0x0, 0x0, 0x0}},
+    {-39000, 1, {0x0, 0x0, 0x0}},
+    {-38601, 1, {0x0, 0x0, 0x0}},
+    {-38514, 1, {0x0, 0x0, 0x0}},
+    {-38461, 1, {0x0, 0x0, 0x0}},
+    {-38202, 1, {0x0, 0x0, 0x0}},
+    {-37917, 1, {0x0, 0x0, 0x0}},
+    {-37755, 1, {0x0, 0x0, 0x0}},
+    {-37752, 1, {0x0, 0x0, 0x0}},
+    {-37694, 1, {0x0, 0x0, 0x0}},
+    {-36636, 1, {0x0, 0x0, 0x0}},
+    {-36572, 1, {0x0, 0x0, 0x0}},
+    {-36182, 1, {0x0, 0x0, 0x0}},
+    {-35773, 1, {0x0, 0x0, 0x0}},
+    {-35790, 1, {0x0, 0x0, 0x0}},
+    {-35704, 1, {0x0, 0x0, 0x0}},
+    {-35453, 1, {0x0, 0x0, 0x0}},
+    {-35118, 1, {0x0, 0x0, 0x0}},
+    {-33526, 1, {0x0, 0x0, 0x0}},
+    {-34921, 1, {0x0, 0x0, 0x0}},
+    {-34800, 1, {0x0, 0x0, 0x0}},
+    {-34678, 1, {0x0, 0x0, 0x0}},
+    {-34352, 1, {0x0, 0x0, 0x0}},
+    {-34204, 1, {0x0, 0x0, 0x0}},
+    {-34152, 1, {0x0, 0x0, 0x0}},
+    {-33927, 1, {0x0, 0x0, 0x0}},
+    {-33926, 1, {0x0, 0x0, 0x0}},
+    {-33756, 1, {0x0, 0x0, 0x0}},
+    {-33740, 1, {0x0, 0x0, 0x0}},
+    {-33716, 1, {0x0, 0x0, 0x0}},
+    {-33631, 1, {0x0, 0x0, 0x0}},
+    {-33642, 1, {0x0, 0x0, 0x0}},
+    {-33247, 1, {0x0, 0x0, 0x0}},
+    {-32763, 1, {0x0, 0x0, 0x0}},
+    {-32493, 1, {0x0, 0x0, 0x0}},
+    {-32307, 1, {0x0, 0x0, 0x0}},
+    {-32084, 1, {0x0, 0x0, 0x0}},
+    {-31932, 1, {0x0, 0x0, 0x0}},
+    {-31603, 1, {0x0, 0x0, 0x0}},
+    {-31405, 1, {0x0, 0x0, 0x0}},
+    {-30561, 1, {0x0, 0x0, 0x0}},
+    {-30405, 1, {0x0, 0x0, 0x0}},
+    {-29500, 1, {0x0, 0x0, 0x0}},
+    {-29045, 1, {0x0, 0x0, 0x0}},
+    {-28977, 1, {0x0, 0x0, 0x0}},
+    {-28962, 1, {0x0, 0x0, 0x0}},
+    {-28666, 1, {0x0, 0x0, 0x0}},
+    {-28610, 1, {0x0, 0x0, 0x0}},
+    {-28656, 1, {0x0, 0x0, 0x0}},
+    {-28603, 1, {0x0, 0x0, 0x0}},
+    {-28607, 1, {0x0, 0x0, 0x0}},
+    {-28625, 1, {0x0, 0x0, 0x0}},
+    {-28550, 1, {0x0, 0x0, 0x0}},
+    {-28470, 1, {0x0, 0x0, 0x0}},
+    {-28089, 1, {0x0, 0x0, 0x0}},
+    {-27530, 1, {0x0, 0x0, 0x0}},
+    {-27217, 1, {0x0, 0x0, 0x0}},
+    {-26923, 1, {0x0, 0x0, 0x0}},
+    {-26703, 1, {0x0, 0x0, 0x0}},
+    {-25674, 1, {0x0, 0x0, 0x0}},
+    {-25572, 1, {0x0, 0x0, 0x0}},
+    {-25458, 1, {0x0, 0x0, 0x0}},
+    {-25326, 1, {0x0, 0x0, 0x0}},
+    {-25291, 1, {0x0, 0x0, 0x0}},
+    {-25280, 1, {0x0, 0x0, 0x0}},
+    {-25233, 1, {0x0, 0x0, 0x0}},
+    {-24507, 1, {0x0, 0x0, 0x0}},
+    {-23346, 1, {0x0, 0x0, 0x0}},
+    {77179, 1, {0x0, 0x0, 0x0}},
+    {77172, 1, {0x0, 0x0, 0x0}},
+    {80132, 1, {0x0, 0x0, 0x0}},
+    {-48949, 1, {0x0, 0x0, 0x0}},
+    {-47803, 1, {0x0, 0x0, 0x0}},
+    {-47771, 1, {0x0, 0x0, 0x0}},
+    {87924, 1, {0x0, 0x0, 0x0}},
+    {90618, 1, {0x0, 0x0, 0x0}},
+    {99324, 1, {0x0, 0x0, 0x0}},
+    {-23445, 1, {0x0, 0x0, 0x0}},
+    {-23371, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x66, 0x66, 0x0}},
+    {0, 2, {0x66, 0x69, 0x0}},
+    {0, 2, {0x66, 0x6C, 0x0}},
+    {0, 3, {0x66, 0x66, 0x69}},
+    {0, 3, {0x66, 0x66, 0x6C}},
+    {0, 2, {0x73, 0x74, 0x0}},
+    {0, 2, {0x574, 0x576, 0x0}},
+    {0, 2, {0x574, 0x565, 0x0}},
+    {0, 2, {0x574, 0x56B, 0x0}},
+    {0, 2, {0x57E, 0x576, 0x0}},
+    {0, 2, {0x574, 0x56D, 0x0}},
+    {0, 2, {0x5D9, 0x5B4, 0x0}},
+    {0, 2, {0x5F2, 0x5B7, 0x0}},
+    {-62782, 1, {0x0, 0x0, 0x0}},
+    {-62801, 1, {0x0, 0x0, 0x0}},
+    {-62799, 1, {0x0, 0x0, 0x0}},
+    {-62793, 1, {0x0, 0x0, 0x0}},
+    {-62783, 1, {0x0, 0x0, 0x0}},
+    {-64254, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x5E9, 0x5C1, 0x0}},
+    {0, 2, {0x5E9, 0x5C2, 0x0}},
+    {0, 3, {0x5E9, 0x5BC, 0x5C1}},
+    {0, 3, {0x5E9, 0x5BC, 0x5C2}},
+    {0, 2, {0x5D0, 0x5B7, 0x0}},
+    {0, 2, {0x5D0, 0x5B8, 0x0}},
+    {0, 2, {0x5D0, 0x5BC, 0x0}},
+    {0, 2, {0x5D1, 0x5BC, 0x0}},
+    {0, 2, {0x5D2, 0x5BC, 0x0}},
+    {0, 2, {0x5D3, 0x5BC, 0x0}},
+    {0, 2, {0x5D4, 0x5BC, 0x0}},
+    {0, 2, {0x5D5, 0x5BC, 0x0}},
+    {0, 2, {0x5D6, 0x5BC, 0x0}},
+    {0, 2, {0x5D8, 0x5BC, 0x0}},
+    {0, 2, {0x5D9, 0x5BC, 0x0}},
+    {0, 2, {0x5DA, 0x5BC, 0x0}},
+    {0, 2, {0x5DB, 0x5BC, 0x0}},
+    {0, 2, {0x5DC, 0x5BC, 0x0}},
+    {0, 2, {0x5DE, 0x5BC, 0x0}},
+    {0, 2, {0x5E0, 0x5BC, 0x0}},
+    {0, 2, {0x5E1, 0x5BC, 0x0}},
+    {0, 2, {0x5E3, 0x5BC, 0x0}},
+    {0, 2, {0x5E4, 0x5BC, 0x0}},
+    {0, 2, {0x5E6, 0x5BC, 0x0}},
+    {0, 2, {0x5E7, 0x5BC, 0x0}},
+    {0, 2, {0x5E8, 0x5BC, 0x0}},
+    {0, 2, {0x5E9, 0x5BC, 0x0}},
+    {0, 2, {0x5EA, 0x5BC, 0x0}},
+    {0, 2, {0x5D5, 0x5B9, 0x0}},
+    {0, 2, {0x5D1, 0x5BF, 0x0}},
+    {0, 2, {0x5DB, 0x5BF, 0x0}},
+    {0, 2, {0x5E4, 0x5BF, 0x0}},
+    {-65248, 1, {0x0, 0x0, 0x0}},
+    {-65216, 1, {0x0, 0x0, 0x0}},
+    {-54746, 1, {0x0, 0x0, 0x0}},
+    {-53087, 1, {0x0, 0x0, 0x0}},
+    {-53078, 1, {0x0, 0x0, 0x0}},
+    {-53091, 1, {0x0, 0x0, 0x0}},
+    {-52842, 1, {0x0, 0x0, 0x0}},
+    {-52852, 1, {0x0, 0x0, 0x0}},
+    {-52934, 1, {0x0, 0x0, 0x0}},
+    {-52933, 1, {0x0, 0x0, 0x0}},
+    {-52932, 1, {0x0, 0x0, 0x0}},
+    {-52931, 1, {0x0, 0x0, 0x0}},
+    {-52930, 1, {0x0, 0x0, 0x0}},
+    {-52873, 1, {0x0, 0x0, 0x0}},
+    {-52872, 1, {0x0, 0x0, 0x0}},
+    {-52871, 1, {0x0, 0x0, 0x0}},
+    {-52908, 1, {0x0, 0x0, 0x0}},
+    {-52943, 1, {0x0, 0x0, 0x0}},
+    {-52942, 1, {0x0, 0x0, 0x0}},
+    {-52941, 1, {0x0, 0x0, 0x0}},
+    {-52940, 1, {0x0, 0x0, 0x0}},
+    {-52939, 1, {0x0, 0x0, 0x0}},
+    {-52938, 1, {0x0, 0x0, 0x0}},
+    {-52937, 1, {0x0, 0x0, 0x0}},
+    {-52936, 1, {0x0, 0x0, 0x0}},
+    {-52935, 1, {0x0, 0x0, 0x0}},
+    {-52929, 1, {0x0, 0x0, 0x0}},
+    {-52928, 1, {0x0, 0x0, 0x0}},
+    {-52926, 1, {0x0, 0x0, 0x0}},
+    {-52925, 1, {0x0, 0x0, 0x0}},
+    {-52924, 1, {0x0, 0x0, 0x0}},
+    {-52923, 1, {0x0, 0x0, 0x0}},
+    {-52921, 1, {0x0, 0x0, 0x0}},
+    {-52919, 1, {0x0, 0x0, 0x0}},
+    {-52917, 1, {0x0, 0x0, 0x0}},
+    {-52915, 1, {0x0, 0x0, 0x0}},
+    {-52913, 1, {0x0, 0x0, 0x0}},
+    {-52912, 1, {0x0, 0x0, 0x0}},
+    {-52911, 1, {0x0, 0x0, 0x0}},
+    {-52910, 1, {0x0, 0x0, 0x0}},
+    {-52909, 1, {0x0, 0x0, 0x0}},
+    {-52906, 1, {0x0, 0x0, 0x0}},
+    {-52997, 1, {0x0, 0x0, 0x0}},
+    {-60992, 1, {0x0, 0x0, 0x0}},
+    {-61089, 1, {0x0, 0x0, 0x0}},
+    {-60921, 1, {0x0, 0x0, 0x0}},
+    {-61090, 1, {0x0, 0x0, 0x0}},
+    {-61092, 1, {0x0, 0x0, 0x0}},
+    {-60922, 1, {0x0, 0x0, 0x0}},
+    {-61078, 1, {0x0, 0x0, 0x0}},
+    {-61099, 1, {0x0, 0x0, 0x0}},
+    {-61075, 1, {0x0, 0x0, 0x0}},
+    {-61100, 1, {0x0, 0x0, 0x0}},
+    {-61025, 1, {0x0, 0x0, 0x0}},
+    {-61027, 1, {0x0, 0x0, 0x0}},
+    {-61029, 1, {0x0, 0x0, 0x0}},
+    {-61031, 1, {0x0, 0x0, 0x0}},
+    {-65342, 1, {0x0, 0x0, 0x0}},
+    {-65334, 1, {0x0, 0x0, 0x0}},
+    {-65475, 1, {0x0, 0x0, 0x0}},
+    {-65344, 1, {0x0, 0x0, 0x0}},
+    {-57149, 1, {0x0, 0x0, 0x0}},
+    {-56038, 1, {0x0, 0x0, 0x0}},
+    {-56921, 1, {0x0, 0x0, 0x0}},
+    {-55885, 1, {0x0, 0x0, 0x0}},
+    {-55843, 1, {0x0, 0x0, 0x0}},
+    {40, 1, {0x0, 0x0, 0x0}},
+    {39, 1, {0x0, 0x0, 0x0}},
+    {64, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x1D157, 0x1D165, 0x0}},
+    {0, 2, {0x1D158, 0x1D165, 0x0}},
+    {0, 3, {0x1D158, 0x1D165, 0x1D16E}},
+    {0, 3, {0x1D158, 0x1D165, 0x1D16F}},
+    {0, 3, {0x1D158, 0x1D165, 0x1D170}},
+    {0, 3, {0x1D158, 0x1D165, 0x1D171}},
+    {0, 3, {0x1D158, 0x1D165, 0x1D172}},
+    {0, 2, {0x1D1B9, 0x1D165, 0x0}},
+    {0, 2, {0x1D1BA, 0x1D165, 0x0}},
+    {0, 3, {0x1D1B9, 0x1D165, 0x1D16E}},
+    {0, 3, {0x1D1BA, 0x1D165, 0x1D16E}},
+    {0, 3, {0x1D1B9, 0x1D165, 0x1D16F}},
+    {0, 3, {0x1D1BA, 0x1D165, 0x1D16F}},
+    {-119711, 1, {0x0, 0x0, 0x0}},
+    {-119737, 1, {0x0, 0x0, 0x0}},
+    {-119763, 1, {0x0, 0x0, 0x0}},
+    {-119789, 1, {0x0, 0x0, 0x0}},
+    {-119815, 1, {0x0, 0x0, 0x0}},
+    {-119841, 1, {0x0, 0x0, 0x0}},
+    {-119867, 1, {0x0, 0x0, 0x0}},
+    {-119893, 1, {0x0, 0x0, 0x0}},
+    {-119919, 1, {0x0, 0x0, 0x0}},
+    {-119945, 1, {0x0, 0x0, 0x0}},
+    {-119971, 1, {0x0, 0x0, 0x0}},
+    {-119997, 1, {0x0, 0x0, 0x0}},
+    {-120023, 1, {0x0, 0x0, 0x0}},
+    {-120049, 1, {0x0, 0x0, 0x0}},
+    {-120075, 1, {0x0, 0x0, 0x0}},
+    {-120101, 1, {0x0, 0x0, 0x0}},
+    {-120127, 1, {0x0, 0x0, 0x0}},
+    {-120153, 1, {0x0, 0x0, 0x0}},
+    {-120179, 1, {0x0, 0x0, 0x0}},
+    {-120205, 1, {0x0, 0x0, 0x0}},
+    {-120231, 1, {0x0, 0x0, 0x0}},
+    {-120257, 1, {0x0, 0x0, 0x0}},
+    {-120283, 1, {0x0, 0x0, 0x0}},
+    {-120309, 1, {0x0, 0x0, 0x0}},
+    {-120335, 1, {0x0, 0x0, 0x0}},
+    {-120361, 1, {0x0, 0x0, 0x0}},
+    {-119918, 1, {0x0, 0x0, 0x0}},
+    {-119543, 1, {0x0, 0x0, 0x0}},
+    {-119553, 1, {0x0, 0x0, 0x0}},
+    {-111802, 1, {0x0, 0x0, 0x0}},
+    {-119569, 1, {0x0, 0x0, 0x0}},
+    {-119568, 1, {0x0, 0x0, 0x0}},
+    {-111833, 1, {0x0, 0x0, 0x0}},
+    {-119591, 1, {0x0, 0x0, 0x0}},
+    {-119589, 1, {0x0, 0x0, 0x0}},
+    {-119588, 1, {0x0, 0x0, 0x0}},
+    {-119577, 1, {0x0, 0x0, 0x0}},
+    {-119583, 1, {0x0, 0x0, 0x0}},
+    {-119585, 1, {0x0, 0x0, 0x0}},
+    {-119601, 1, {0x0, 0x0, 0x0}},
+    {-119611, 1, {0x0, 0x0, 0x0}},
+    {-111860, 1, {0x0, 0x0, 0x0}},
+    {-119627, 1, {0x0, 0x0, 0x0}},
+    {-119626, 1, {0x0, 0x0, 0x0}},
+    {-111891, 1, {0x0, 0x0, 0x0}},
+    {-119649, 1, {0x0, 0x0, 0x0}},
+    {-119647, 1, {0x0, 0x0, 0x0}},
+    {-119646, 1, {0x0, 0x0, 0x0}},
+    {-119635, 1, {0x0, 0x0, 0x0}},
+    {-119641, 1, {0x0, 0x0, 0x0}},
+    {-119643, 1, {0x0, 0x0, 0x0}},
+    {-119659, 1, {0x0, 0x0, 0x0}},
+    {-119669, 1, {0x0, 0x0, 0x0}},
+    {-111918, 1, {0x0, 0x0, 0x0}},
+    {-119685, 1, {0x0, 0x0, 0x0}},
+    {-119684, 1, {0x0, 0x0, 0x0}},
+    {-111949, 1, {0x0, 0x0, 0x0}},
+    {-119707, 1, {0x0, 0x0, 0x0}},
+    {-119705, 1, {0x0, 0x0, 0x0}},
+    {-119704, 1, {0x0, 0x0, 0x0}},
+    {-119693, 1, {0x0, 0x0, 0x0}},
+    {-119699, 1, {0x0, 0x0, 0x0}},
+    {-119701, 1, {0x0, 0x0, 0x0}},
+    {-119717, 1, {0x0, 0x0, 0x0}},
+    {-119727, 1, {0x0, 0x0, 0x0}},
+    {-111976, 1, {0x0, 0x0, 0x0}},
+    {-119743, 1, {0x0, 0x0, 0x0}},
+    {-119742, 1, {0x0, 0x0, 0x0}},
+    {-112007, 1, {0x0, 0x0, 0x0}},
+    {-119765, 1, {0x0, 0x0, 0x0}},
+    {-119762, 1, {0x0, 0x0, 0x0}},
+    {-119751, 1, {0x0, 0x0, 0x0}},
+    {-119757, 1, {0x0, 0x0, 0x0}},
+    {-119759, 1, {0x0, 0x0, 0x0}},
+    {-119775, 1, {0x0, 0x0, 0x0}},
+    {-119785, 1, {0x0, 0x0, 0x0}},
+    {-112034, 1, {0x0, 0x0, 0x0}},
+    {-119801, 1, {0x0, 0x0, 0x0}},
+    {-119800, 1, {0x0, 0x0, 0x0}},
+    {-112065, 1, {0x0, 0x0, 0x0}},
+    {-119823, 1, {0x0, 0x0, 0x0}},
+    {-119821, 1, {0x0, 0x0, 0x0}},
+    {-119820, 1, {0x0, 0x0, 0x0}},
+    {-119809, 1, {0x0, 0x0, 0x0}},
+    {-119817, 1, {0x0, 0x0, 0x0}},
+    {-119790, 1, {0x0, 0x0, 0x0}},
+    {-120734, 1, {0x0, 0x0, 0x0}},
+    {-120744, 1, {0x0, 0x0, 0x0}},
+    {-120754, 1, {0x0, 0x0, 0x0}},
+    {-120764, 1, {0x0, 0x0, 0x0}},
+    {-120774, 1, {0x0, 0x0, 0x0}},
+    {34, 1, {0x0, 0x0, 0x0}},
+    {-124889, 1, {0x0, 0x0, 0x0}},
+    {-124886, 1, {0x0, 0x0, 0x0}},
+    {-124884, 1, {0x0, 0x0, 0x0}},
+    {-124861, 1, {0x0, 0x0, 0x0}},
+    {-124890, 1, {0x0, 0x0, 0x0}},
+    {-124881, 1, {0x0, 0x0, 0x0}},
+    {-124863, 1, {0x0, 0x0, 0x0}},
+    {-124871, 1, {0x0, 0x0, 0x0}},
+    {-124891, 1, {0x0, 0x0, 0x0}},
+    {-124879, 1, {0x0, 0x0, 0x0}},
+    {-124892, 1, {0x0, 0x0, 0x0}},
+    {-124880, 1, {0x0, 0x0, 0x0}},
+    {-124898, 1, {0x0, 0x0, 0x0}},
+    {-124896, 1, {0x0, 0x0, 0x0}},
+    {-124907, 1, {0x0, 0x0, 0x0}},
+    {-124905, 1, {0x0, 0x0, 0x0}},
+    {-124904, 1, {0x0, 0x0, 0x0}},
+    {-124899, 1, {0x0, 0x0, 0x0}},
+    {-124897, 1, {0x0, 0x0, 0x0}},
+    {-124846, 1, {0x0, 0x0, 0x0}},
+    {-124771, 1, {0x0, 0x0, 0x0}},
+    {-124797, 1, {0x0, 0x0, 0x0}},
+    {-124848, 1, {0x0, 0x0, 0x0}},
+    {-124921, 1, {0x0, 0x0, 0x0}},
+    {-124918, 1, {0x0, 0x0, 0x0}},
+    {-124893, 1, {0x0, 0x0, 0x0}},
+    {-124922, 1, {0x0, 0x0, 0x0}},
+    {-124895, 1, {0x0, 0x0, 0x0}},
+    {-124903, 1, {0x0, 0x0, 0x0}},
+    {-124923, 1, {0x0, 0x0, 0x0}},
+    {-124911, 1, {0x0, 0x0, 0x0}},
+    {-124924, 1, {0x0, 0x0, 0x0}},
+    {-124912, 1, {0x0, 0x0, 0x0}},
+    {-124928, 1, {0x0, 0x0, 0x0}},
+    {-124939, 1, {0x0, 0x0, 0x0}},
+    {-124937, 1, {0x0, 0x0, 0x0}},
+    {-124931, 1, {0x0, 0x0, 0x0}},
+    {-124929, 1, {0x0, 0x0, 0x0}},
+    {-124950, 1, {0x0, 0x0, 0x0}},
+    {-124954, 1, {0x0, 0x0, 0x0}},
+    {-124927, 1, {0x0, 0x0, 0x0}},
+    {-124935, 1, {0x0, 0x0, 0x0}},
+    {-124955, 1, {0x0, 0x0, 0x0}},
+    {-124956, 1, {0x0, 0x0, 0x0}},
+    {-124944, 1, {0x0, 0x0, 0x0}},
+    {-124960, 1, {0x0, 0x0, 0x0}},
+    {-124969, 1, {0x0, 0x0, 0x0}},
+    {-124963, 1, {0x0, 0x0, 0x0}},
+    {-124961, 1, {0x0, 0x0, 0x0}},
+    {-124835, 1, {0x0, 0x0, 0x0}},
+    {-124985, 1, {0x0, 0x0, 0x0}},
+    {-124982, 1, {0x0, 0x0, 0x0}},
+    {-124957, 1, {0x0, 0x0, 0x0}},
+    {-124986, 1, {0x0, 0x0, 0x0}},
+    {-124977, 1, {0x0, 0x0, 0x0}},
+    {-124959, 1, {0x0, 0x0, 0x0}},
+    {-124967, 1, {0x0, 0x0, 0x0}},
+    {-124987, 1, {0x0, 0x0, 0x0}},
+    {-124975, 1, {0x0, 0x0, 0x0}},
+    {-124988, 1, {0x0, 0x0, 0x0}},
+    {-124976, 1, {0x0, 0x0, 0x0}},
+    {-124992, 1, {0x0, 0x0, 0x0}},
+    {-125003, 1, {0x0, 0x0, 0x0}},
+    {-125001, 1, {0x0, 0x0, 0x0}},
+    {-124995, 1, {0x0, 0x0, 0x0}},
+    {-124994, 1, {0x0, 0x0, 0x0}},
+    {-124993, 1, {0x0, 0x0, 0x0}},
+    {-124942, 1, {0x0, 0x0, 0x0}},
+    {-125017, 1, {0x0, 0x0, 0x0}},
+    {-125014, 1, {0x0, 0x0, 0x0}},
+    {-125012, 1, {0x0, 0x0, 0x0}},
+    {-124989, 1, {0x0, 0x0, 0x0}},
+    {-125018, 1, {0x0, 0x0, 0x0}},
+    {-125009, 1, {0x0, 0x0, 0x0}},
+    {-124991, 1, {0x0, 0x0, 0x0}},
+    {-124999, 1, {0x0, 0x0, 0x0}},
+    {-125019, 1, {0x0, 0x0, 0x0}},
+    {-125007, 1, {0x0, 0x0, 0x0}},
+    {-125020, 1, {0x0, 0x0, 0x0}},
+    {-125008, 1, {0x0, 0x0, 0x0}},
+    {-125026, 1, {0x0, 0x0, 0x0}},
+    {-125024, 1, {0x0, 0x0, 0x0}},
+    {-125035, 1, {0x0, 0x0, 0x0}},
+    {-125033, 1, {0x0, 0x0, 0x0}},
+    {-125032, 1, {0x0, 0x0, 0x0}},
+    {-125027, 1, {0x0, 0x0, 0x0}},
+    {-125025, 1, {0x0, 0x0, 0x0}},
+    {-125049, 1, {0x0, 0x0, 0x0}},
+    {-125046, 1, {0x0, 0x0, 0x0}},
+    {-125044, 1, {0x0, 0x0, 0x0}},
+    {-125021, 1, {0x0, 0x0, 0x0}},
+    {-125050, 1, {0x0, 0x0, 0x0}},
+    {-125041, 1, {0x0, 0x0, 0x0}},
+    {-125023, 1, {0x0, 0x0, 0x0}},
+    {-125031, 1, {0x0, 0x0, 0x0}},
+    {-125051, 1, {0x0, 0x0, 0x0}},
+    {-125039, 1, {0x0, 0x0, 0x0}},
+    {-125052, 1, {0x0, 0x0, 0x0}},
+    {-125040, 1, {0x0, 0x0, 0x0}},
+    {-125058, 1, {0x0, 0x0, 0x0}},
+    {-125056, 1, {0x0, 0x0, 0x0}},
+    {-125067, 1, {0x0, 0x0, 0x0}},
+    {-125065, 1, {0x0, 0x0, 0x0}},
+    {-125064, 1, {0x0, 0x0, 0x0}},
+    {-125059, 1, {0x0, 0x0, 0x0}},
+    {-125057, 1, {0x0, 0x0, 0x0}},
+    {-127176, 1, {0x0, 0x0, 0x0}},
+    {-127162, 1, {0x0, 0x0, 0x0}},
+    {0, 2, {0x63, 0x64, 0x0}},
+    {0, 2, {0x77, 0x7A, 0x0}},
+    {-103097, 1, {0x0, 0x0, 0x0}},
+    {-106082, 1, {0x0, 0x0, 0x0}},
+    {-129984, 1, {0x0, 0x0, 0x0}},
+    {-174531, 1, {0x0, 0x0, 0x0}},
+    {-174537, 1, {0x0, 0x0, 0x0}},
+    {-174529, 1, {0x0, 0x0, 0x0}},
+    {-63201, 1, {0x0, 0x0, 0x0}},
+    {-174244, 1, {0x0, 0x0, 0x0}},
+    {-174167, 1, {0x0, 0x0, 0x0}},
+    {-174155, 1, {0x0, 0x0, 0x0}},
+    {-174085, 1, {0x0, 0x0, 0x0}},
+    {-173966, 1, {0x0, 0x0, 0x0}},
+    {-173936, 1, {0x0, 0x0, 0x0}},
+    {-173859, 1, {0x0, 0x0, 0x0}},
+    {-173884, 1, {0x0, 0x0, 0x0}},
+    {-181102, 1, {0x0, 0x0, 0x0}},
+    {-61907, 1, {0x0, 0x0, 0x0}},
+    {-173761, 1, {0x0, 0x0, 0x0}},
+    {-173755, 1, {0x0, 0x0, 0x0}},
+    {-173740, 1, {0x0, 0x0, 0x0}},
+    {-173722, 1, {0x0, 0x0, 0x0}},
+    {-62198, 1, {0x0, 0x0, 0x0}},
+    {-181082, 1, {0x0, 0x0, 0x0}},
+    {-173741, 1, {0x0, 0x0, 0x0}},
+    {-173704, 1, {0x0, 0x0, 0x0}},
+    {-62155, 1, {0x0, 0x0, 0x0}},
+    {-173696, 1, {0x0, 0x0, 0x0}},
+    {-173684, 1, {0x0, 0x0, 0x0}},
+    {-174413, 1, {0x0, 0x0, 0x0}},
+    {-173678, 1, {0x0, 0x0, 0x0}},
+    {-173670, 1, {0x0, 0x0, 0x0}},
+    {-26173, 1, {0x0, 0x0, 0x0}},
+    {-173608, 1, {0x0, 0x0, 0x0}},
+    {-173595, 1, {0x0, 0x0, 0x0}},
+    {-181056, 1, {0x0, 0x0, 0x0}},
+    {-173541, 1, {0x0, 0x0, 0x0}},
+    {-173531, 1, {0x0, 0x0, 0x0}},
+    {-173488, 1, {0x0, 0x0, 0x0}},
+    {-173484, 1, {0x0, 0x0, 0x0}},
+    {-181007, 1, {0x0, 0x0, 0x0}},
+    {-173406, 1, {0x0, 0x0, 0x0}},
+    {-173405, 1, {0x0, 0x0, 0x0}},
+    {-173379, 1, {0x0, 0x0, 0x0}},
+    {-173358, 1, {0x0, 0x0, 0x0}},
+    {-173348, 1, {0x0, 0x0, 0x0}},
+    {-173332, 1, {0x0, 0x0, 0x0}},
+    {-173283, 1, {0x0, 0x0, 0x0}},
+    {-173276, 1, {0x0, 0x0, 0x0}},
+    {-173268, 1, {0x0, 0x0, 0x0}},
+    {-173244, 1, {0x0, 0x0, 0x0}},
+    {-173235, 1, {0x0, 0x0, 0x0}},
+    {-173234, 1, {0x0, 0x0, 0x0}},
+    {-173236, 1, {0x0, 0x0, 0x0}},
+    {-60936, 1, {0x0, 0x0, 0x0}},
+    {-165829, 1, {0x0, 0x0, 0x0}},
+    {-173164, 1, {0x0, 0x0, 0x0}},
+    {-173144, 1, {0x0, 0x0, 0x0}},
+    {-60629, 1, {0x0, 0x0, 0x0}},
+    {-173134, 1, {0x0, 0x0, 0x0}},
+    {-173129, 1, {0x0, 0x0, 0x0}},
+    {-173109, 1, {0x0, 0x0, 0x0}},
+    {-172958, 1, {0x0, 0x0, 0x0}},
+    {-173061, 1, {0x0, 0x0, 0x0}},
+    {-173046, 1, {0x0, 0x0, 0x0}},
+    {-173015, 1, {0x0, 0x0, 0x0}},
+    {-172875, 1, {0x0, 0x0, 0x0}},
+    {-172850, 1, {0x0, 0x0, 0x0}},
+    {-172784, 1, {0x0, 0x0, 0x0}},
+    {-172769, 1, {0x0, 0x0, 0x0}},
+    {-172737, 1, {0x0, 0x0, 0x0}},
+    {-172738, 1, {0x0, 0x0, 0x0}},
+    {-172718, 1, {0x0, 0x0, 0x0}},
+    {-172701, 1, {0x0, 0x0, 0x0}},
+    {-172694, 1, {0x0, 0x0, 0x0}},
+    {-172680, 1, {0x0, 0x0, 0x0}},
+    {-172341, 1, {0x0, 0x0, 0x0}},
+    {-172614, 1, {0x0, 0x0, 0x0}},
+    {-172342, 1, {0x0, 0x0, 0x0}},
+    {-172541, 1, {0x0, 0x0, 0x0}},
+    {-172507, 1, {0x0, 0x0, 0x0}},
+    {-173641, 1, {0x0, 0x0, 0x0}},
+    {-171875, 1, {0x0, 0x0, 0x0}},
+    {-172164, 1, {0x0, 0x0, 0x0}},
+    {-172127, 1, {0x0, 0x0, 0x0}},
+    {-172103, 1, {0x0, 0x0, 0x0}},
+    {-172234, 1, {0x0, 0x0, 0x0}},
+    {-172068, 1, {0x0, 0x0, 0x0}},
+    {-172070, 1, {0x0, 0x0, 0x0}},
+    {-171948, 1, {0x0, 0x0, 0x0}},
+    {-58229, 1, {0x0, 0x0, 0x0}},
+    {-171880, 1, {0x0, 0x0, 0x0}},
+    {-171876, 1, {0x0, 0x0, 0x0}},
+    {-171862, 1, {0x0, 0x0, 0x0}},
+    {-171843, 1, {0x0, 0x0, 0x0}},
+    {-171836, 1, {0x0, 0x0, 0x0}},
+    {-171773, 1, {0x0, 0x0, 0x0}},
+    {-57784, 1, {0x0, 0x0, 0x0}},
+    {-57719, 1, {0x0, 0x0, 0x0}},
+    {-171638, 1, {0x0, 0x0, 0x0}},
+    {-171592, 1, {0x0, 0x0, 0x0}},
+    {-171581, 1, {0x0, 0x0, 0x0}},
+    {-171661, 1, {0x0, 0x0, 0x0}},
+    {-171520, 1, {0x0, 0x0, 0x0}},
+    {-180601, 1, {0x0, 0x0, 0x0}},
+    {-180588, 1, {0x0, 0x0, 0x0}},
+    {-171361, 1, {0x0, 0x0, 0x0}},
+    {-171308, 1, {0x0, 0x0, 0x0}},
+    {-171309, 1, {0x0, 0x0, 0x0}},
+    {-56996, 1, {0x0, 0x0, 0x0}},
+    {-171178, 1, {0x0, 0x0, 0x0}},
+    {-171158, 1, {0x0, 0x0, 0x0}},
+    {-171144, 1, {0x0, 0x0, 0x0}},
+    {-171133, 1, {0x0, 0x0, 0x0}},
+    {-56665, 1, {0x0, 0x0, 0x0}},
+    {-171123, 1, {0x0, 0x0, 0x0}},
+    {-171117, 1, {0x0, 0x0, 0x0}},
+    {-170273, 1, {0x0, 0x0, 0x0}},
+    {-171091, 1, {0x0, 0x0, 0x0}},
+    {-180469, 1, {0x0, 0x0, 0x0}},
+    {-171031, 1, {0x0, 0x0, 0x0}},
+    {-171018, 1, {0x0, 0x0, 0x0}},
+    {-170937, 1, {0x0, 0x0, 0x0}},
+    {-170989, 1, {0x0, 0x0, 0x0}},
+    {-55959, 1, {0x0, 0x0, 0x0}},
+    {-170809, 1, {0x0, 0x0, 0x0}},
+    {-170768, 1, {0x0, 0x0, 0x0}},
+    {-170772, 1, {0x0, 0x0, 0x0}},
+    {-170756, 1, {0x0, 0x0, 0x0}},
+    {-170656, 1, {0x0, 0x0, 0x0}},
+    {-180308, 1, {0x0, 0x0, 0x0}},
+    {-170631, 1, {0x0, 0x0, 0x0}},
+    {-170589, 1, {0x0, 0x0, 0x0}},
+    {-170569, 1, {0x0, 0x0, 0x0}},
+    {-170526, 1, {0x0, 0x0, 0x0}},
+    {-180262, 1, {0x0, 0x0, 0x0}},
+    {-55046, 1, {0x0, 0x0, 0x0}},
+    {-180238, 1, {0x0, 0x0, 0x0}},
+    {-170459, 1, {0x0, 0x0, 0x0}},
+    {-170457, 1, {0x0, 0x0, 0x0}},
+    {-170455, 1, {0x0, 0x0, 0x0}},
+    {-170436, 1, {0x0, 0x0, 0x0}},
+    {-21757, 1, {0x0, 0x0, 0x0}},
+    {-170386, 1, {0x0, 0x0, 0x0}},
+    {-54624, 1, {0x0, 0x0, 0x0}},
+    {-54625, 1, {0x0, 0x0, 0x0}},
+    {-161426, 1, {0x0, 0x0, 0x0}},
+    {-170354, 1, {0x0, 0x0, 0x0}},
+    {-170355, 1, {0x0, 0x0, 0x0}},
+    {-180175, 1, {0x0, 0x0, 0x0}},
+    {-50655, 1, {0x0, 0x0, 0x0}},
+    {-38590, 1, {0x0, 0x0, 0x0}},
+    {-170295, 1, {0x0, 0x0, 0x0}},
+    {-170287, 1, {0x0, 0x0, 0x0}},
+    {-180152, 1, {0x0, 0x0, 0x0}},
+    {-170242, 1, {0x0, 0x0, 0x0}},
+    {-170192, 1, {0x0, 0x0, 0x0}},
+    {-170183, 1, {0x0, 0x0, 0x0}},
+    {-170150, 1, {0x0, 0x0, 0x0}},
+    {-170015, 1, {0x0, 0x0, 0x0}},
+    {-180071, 1, {0x0, 0x0, 0x0}},
+    {-180102, 1, {0x0, 0x0, 0x0}},
+    {-169999, 1, {0x0, 0x0, 0x0}},
+    {-53712, 1, {0x0, 0x0, 0x0}},
+    {-169950, 1, {0x0, 0x0, 0x0}},
+    {-169822, 1, {0x0, 0x0, 0x0}},
+    {-169819, 1, {0x0, 0x0, 0x0}},
+    {-169818, 1, {0x0, 0x0, 0x0}},
+    {-169821, 1, {0x0, 0x0, 0x0}},
+    {-169776, 1, {0x0, 0x0, 0x0}},
+    {-169757, 1, {0x0, 0x0, 0x0}},
+    {-169722, 1, {0x0, 0x0, 0x0}},
+    {-169737, 1, {0x0, 0x0, 0x0}},
+    {-169727, 1, {0x0, 0x0, 0x0}},
+    {-169681, 1, {0x0, 0x0, 0x0}},
+    {-169662, 1, {0x0, 0x0, 0x0}},
+    {-169659, 1, {0x0, 0x0, 0x0}},
+    {-169634, 1, {0x0, 0x0, 0x0}},
+    {-169624, 1, {0x0, 0x0, 0x0}},
+    {-169559, 1, {0x0, 0x0, 0x0}},
+    {-169476, 1, {0x0, 0x0, 0x0}},
+    {-169442, 1, {0x0, 0x0, 0x0}},
+    {-169319, 1, {0x0, 0x0, 0x0}},
+    {-52652, 1, {0x0, 0x0, 0x0}},
+    {-169340, 1, {0x0, 0x0, 0x0}},
+    {-169406, 1, {0x0, 0x0, 0x0}},
+    {-169299, 1, {0x0, 0x0, 0x0}},
+    {-169273, 1, {0x0, 0x0, 0x0}},
+    {-169177, 1, {0x0, 0x0, 0x0}},
+    {-52429, 1, {0x0, 0x0, 0x0}},
+    {-169117, 1, {0x0, 0x0, 0x0}},
+    {-169211, 1, {0x0, 0x0, 0x0}},
+    {-169240, 1, {0x0, 0x0, 0x0}},
+    {-179860, 1, {0x0, 0x0, 0x0}},
+    {-169050, 1, {0x0, 0x0, 0x0}},
+    {-169030, 1, {0x0, 0x0, 0x0}},
+    {-169000, 1, {0x0, 0x0, 0x0}},
+    {-169039, 1, {0x0, 0x0, 0x0}},
+    {-179803, 1, {0x0, 0x0, 0x0}},
+    {-168825, 1, {0x0, 0x0, 0x0}},
+    {-168797, 1, {0x0, 0x0, 0x0}},
+    {-51392, 1, {0x0, 0x0, 0x0}},
+    {-168680, 1, {0x0, 0x0, 0x0}},
+    {-168404, 1, {0x0, 0x0, 0x0}},
+    {-168580, 1, {0x0, 0x0, 0x0}},
+    {-179637, 1, {0x0, 0x0, 0x0}},
+    {-168510, 1, {0x0, 0x0, 0x0}},
+    {-179656, 1, {0x0, 0x0, 0x0}},
+    {-179693, 1, {0x0, 0x0, 0x0}},
+    {-173888, 1, {0x0, 0x0, 0x0}},
+    {-173886, 1, {0x0, 0x0, 0x0}},
+    {-168505, 1, {0x0, 0x0, 0x0}},
+    {-161833, 1, {0x0, 0x0, 0x0}},
+    {-177406, 1, {0x0, 0x0, 0x0}},
+    {-168385, 1, {0x0, 0x0, 0x0}},
+    {-168382, 1, {0x0, 0x0, 0x0}},
+    {-168377, 1, {0x0, 0x0, 0x0}},
+    {-168317, 1, {0x0, 0x0, 0x0}},
+    {-168329, 1, {0x0, 0x0, 0x0}},
+    {-50458, 1, {0x0, 0x0, 0x0}},
+    {-179605, 1, {0x0, 0x0, 0x0}},
+    {-168165, 1, {0x0, 0x0, 0x0}},
+    {-168283, 1, {0x0, 0x0, 0x0}},
+    {-168079, 1, {0x0, 0x0, 0x0}},
+    {-168029, 1, {0x0, 0x0, 0x0}},
+    {-50294, 1, {0x0, 0x0, 0x0}},
+    {-168022, 1, {0x0, 0x0, 0x0}},
+    {-168134, 1, {0x0, 0x0, 0x0}},
+    {-167890, 1, {0x0, 0x0, 0x0}},
+    {-179530, 1, {0x0, 0x0, 0x0}},
+    {-167846, 1, {0x0, 0x0, 0x0}},
+    {-167750, 1, {0x0, 0x0, 0x0}},
+    {-167680, 1, {0x0, 0x0, 0x0}},
+    {-167491, 1, {0x0, 0x0, 0x0}},
+    {-49737, 1, {0x0, 0x0, 0x0}},
+    {-167442, 1, {0x0, 0x0, 0x0}},
+    {-179414, 1, {0x0, 0x0, 0x0}},
+    {-167374, 1, {0x0, 0x0, 0x0}},
+    {-49225, 1, {0x0, 0x0, 0x0}},
+    {-167325, 1, {0x0, 0x0, 0x0}},
+    {-179364, 1, {0x0, 0x0, 0x0}},
+    {-167297, 1, {0x0, 0x0, 0x0}},
+    {-167253, 1, {0x0, 0x0, 0x0}},
+    {-167227, 1, {0x0, 0x0, 0x0}},
+    {-48746, 1, {0x0, 0x0, 0x0}},
+    {-56301, 1, {0x0, 0x0, 0x0}},
+    {-48639, 1, {0x0, 0x0, 0x0}},
+    {-167084, 1, {0x0, 0x0, 0x0}},
+    {-48191, 1, {0x0, 0x0, 0x0}},
+    {-166973, 1, {0x0, 0x0, 0x0}},
+    {-166960, 1, {0x0, 0x0, 0x0}},
+    {-167063, 1, {0x0, 0x0, 0x0}},
+    {-166889, 1, {0x0, 0x0, 0x0}},
+    {-166850, 1, {0x0, 0x0, 0x0}},
+    {-166794, 1, {0x0, 0x0, 0x0}},
+    {-166849, 1, {0x0, 0x0, 0x0}},
+    {-166810, 1, {0x0, 0x0, 0x0}},
+    {-166796, 1, {0x0, 0x0, 0x0}},
+    {-166784, 1, {0x0, 0x0, 0x0}},
+    {-48104, 1, {0x0, 0x0, 0x0}},
+    {-166867, 1, {0x0, 0x0, 0x0}},
+    {-166617, 1, {0x0, 0x0, 0x0}},
+    {-166555, 1, {0x0, 0x0, 0x0}},
+    {-179159, 1, {0x0, 0x0, 0x0}},
+    {-166464, 1, {0x0, 0x0, 0x0}},
+    {-166469, 1, {0x0, 0x0, 0x0}},
+    {-47676, 1, {0x0, 0x0, 0x0}},
+    {-166677, 1, {0x0, 0x0, 0x0}},
+    {-166305, 1, {0x0, 0x0, 0x0}},
+    {-47538, 1, {0x0, 0x0, 0x0}},
+    {-47491, 1, {0x0, 0x0, 0x0}},
+    {-166220, 1, {0x0, 0x0, 0x0}},
+    {-166106, 1, {0x0, 0x0, 0x0}},
+    {-166134, 1, {0x0, 0x0, 0x0}},
+    {-166138, 1, {0x0, 0x0, 0x0}},
+    {-179072, 1, {0x0, 0x0, 0x0}},
+    {-166093, 1, {0x0, 0x0, 0x0}},
+    {-166043, 1, {0x0, 0x0, 0x0}},
+    {-166050, 1, {0x0, 0x0, 0x0}},
+    {-165997, 1, {0x0, 0x0, 0x0}},
+    {-62454, 1, {0x0, 0x0, 0x0}},
+    {-165847, 1, {0x0, 0x0, 0x0}},
+    {-46778, 1, {0x0, 0x0, 0x0}},
+    {-165762, 1, {0x0, 0x0, 0x0}},
+    {-46452, 1, {0x0, 0x0, 0x0}},
+    {-165624, 1, {0x0, 0x0, 0x0}},
+    {-165612, 1, {0x0, 0x0, 0x0}},
+    {-165586, 1, {0x0, 0x0, 0x0}},
+    {-45851, 1, {0x0, 0x0, 0x0}},
+    {-165540, 1, {0x0, 0x0, 0x0}},
+    {-165520, 1, {0x0, 0x0, 0x0}},
+    {-45553, 1, {0x0, 0x0, 0x0}},
+    {-45331, 1, {0x0, 0x0, 0x0}},
+    {-165294, 1, {0x0, 0x0, 0x0}},
+    {-165278, 1, {0x0, 0x0, 0x0}},
+    {-178814, 1, {0x0, 0x0, 0x0}},
+    {-165254, 1, {0x0, 0x0, 0x0}},
+    {-178804, 1, {0x0, 0x0, 0x0}},
+    {-178805, 1, {0x0, 0x0, 0x0}},
+    {-165095, 1, {0x0, 0x0, 0x0}},
+    {-165075, 1, {0x0, 0x0, 0x0}},
+    {-165055, 1, {0x0, 0x0, 0x0}},
+    {-165036, 1, {0x0, 0x0, 0x0}},
+    {-164968, 1, {0x0, 0x0, 0x0}},
+    {-178712, 1, {0x0, 0x0, 0x0}},
+    {-164880, 1, {0x0, 0x0, 0x0}},
+    {-44287, 1, {0x0, 0x0, 0x0}},
+    {-164856, 1, {0x0, 0x0, 0x0}},
+    {-44197, 1, {0x0, 0x0, 0x0}},
+    {-164808, 1, {0x0, 0x0, 0x0}},
+    {-55194, 1, {0x0, 0x0, 0x0}},
+    {-164650, 1, {0x0, 0x0, 0x0}},
+    {-43418, 1, {0x0, 0x0, 0x0}},
+    {-43396, 1, {0x0, 0x0, 0x0}},
+    {-43257, 1, {0x0, 0x0, 0x0}},
+    {-178498, 1, {0x0, 0x0, 0x0}},
+    {-178487, 1, {0x0, 0x0, 0x0}},
+    {-164428, 1, {0x0, 0x0, 0x0}},
+    {-43086, 1, {0x0, 0x0, 0x0}},
+    {-43088, 1, {0x0, 0x0, 0x0}},
+    {-43050, 1, {0x0, 0x0, 0x0}},
+    {-43025, 1, {0x0, 0x0, 0x0}},
+    {-164391, 1, {0x0, 0x0, 0x0}},
+    {-164392, 1, {0x0, 0x0, 0x0}},
+    {-164350, 1, {0x0, 0x0, 0x0}},
+    {-178448, 1, {0x0, 0x0, 0x0}},
+    {-164287, 1, {0x0, 0x0, 0x0}},
+    {-178437, 1, {0x0, 0x0, 0x0}},
+    {-178358, 1, {0x0, 0x0, 0x0}},
+    {-42288, 1, {0x0, 0x0, 0x0}},
+    {-164096, 1, {0x0, 0x0, 0x0}},
+    {-164035, 1, {0x0, 0x0, 0x0}},
+    {-163972, 1, {0x0, 0x0, 0x0}},
+    {-178286, 1, {0x0, 0x0, 0x0}},
+    {-41772, 1, {0x0, 0x0, 0x0}},
+    {-163837, 1, {0x0, 0x0, 0x0}},
+    {-41658, 1, {0x0, 0x0, 0x0}},
+    {-41616, 1, {0x0, 0x0, 0x0}},
+    {-163783, 1, {0x0, 0x0, 0x0}},
+    {-163692, 1, {0x0, 0x0, 0x0}},
+    {-178217, 1, {0x0, 0x0, 0x0}},
+    {-163609, 1, {0x0, 0x0, 0x0}},
+    {-163600, 1, {0x0, 0x0, 0x0}},
+    {-163596, 1, {0x0, 0x0, 0x0}},
+    {-40928, 1, {0x0, 0x0, 0x0}},
+    {-40630, 1, {0x0, 0x0, 0x0}},
+    {-40631, 1, {0x0, 0x0, 0x0}},
+    {-163441, 1, {0x0, 0x0, 0x0}},
+    {-178014, 1, {0x0, 0x0, 0x0}},
+    {-40374, 1, {0x0, 0x0, 0x0}},
+    {-163228, 1, {0x0, 0x0, 0x0}},
+    {-163226, 1, {0x0, 0x0, 0x0}},
+    {-177981, 1, {0x0, 0x0, 0x0}},
+    {-40165, 1, {0x0, 0x0, 0x0}},
+    {-162964, 1, {0x0, 0x0, 0x0}},
+    {-177863, 1, {0x0, 0x0, 0x0}},
+    {-162944, 1, {0x0, 0x0, 0x0}},
+    {-162950, 1, {0x0, 0x0, 0x0}},
+    {-162922, 1, {0x0, 0x0, 0x0}},
+    {-39397, 1, {0x0, 0x0, 0x0}},
+    {-162825, 1, {0x0, 0x0, 0x0}},
+    {-177772, 1, {0x0, 0x0, 0x0}},
+    {-162727, 1, {0x0, 0x0, 0x0}},
+    {-162669, 1, {0x0, 0x0, 0x0}},
+    {-162603, 1, {0x0, 0x0, 0x0}},
+    {-177725, 1, {0x0, 0x0, 0x0}},
+    {-38730, 1, {0x0, 0x0, 0x0}},
+    {-38700, 1, {0x0, 0x0, 0x0}},
+    {-177691, 1, {0x0, 0x0, 0x0}},
+    {-38556, 1, {0x0, 0x0, 0x0}},
+    {-162300, 1, {0x0, 0x0, 0x0}},
+    {-38457, 1, {0x0, 0x0, 0x0}},
+    {-162275, 1, {0x0, 0x0, 0x0}},
+    {-162175, 1, {0x0, 0x0, 0x0}},
+    {-162165, 1, {0x0, 0x0, 0x0}},
+    {-38049, 1, {0x0, 0x0, 0x0}},
+    {-37977, 1, {0x0, 0x0, 0x0}},
+    {-162077, 1, {0x0, 0x0, 0x0}},
+    {-37846, 1, {0x0, 0x0, 0x0}},
+    {-162063, 1, {0x0, 0x0, 0x0}},
+    {-50721, 1, {0x0, 0x0, 0x0}},
+    {-177580, 1, {0x0, 0x0, 0x0}},
+    {-162000, 1, {0x0, 0x0, 0x0}},
+    {-161920, 1, {0x0, 0x0, 0x0}},
+    {-177529, 1, {0x0, 0x0, 0x0}},
+    {-161863, 1, {0x0, 0x0, 0x0}},
+    {-171729, 1, {0x0, 0x0, 0x0}},
+    {-37344, 1, {0x0, 0x0, 0x0}},
+    {-37331, 1, {0x0, 0x0, 0x0}},
+    {-50678, 1, {0x0, 0x0, 0x0}},
+    {-50670, 1, {0x0, 0x0, 0x0}},
+    {-161674, 1, {0x0, 0x0, 0x0}},
+    {-161672, 1, {0x0, 0x0, 0x0}},
+    {-158191, 1, {0x0, 0x0, 0x0}},
+    {-177443, 1, {0x0, 0x0, 0x0}},
+    {-161534, 1, {0x0, 0x0, 0x0}},
+    {-161541, 1, {0x0, 0x0, 0x0}},
+    {-161524, 1, {0x0, 0x0, 0x0}},
+    {-173791, 1, {0x0, 0x0, 0x0}},
+    {-161506, 1, {0x0, 0x0, 0x0}},
+    {-161505, 1, {0x0, 0x0, 0x0}},
+    {-161496, 1, {0x0, 0x0, 0x0}},
+    {-161456, 1, {0x0, 0x0, 0x0}},
+    {-36443, 1, {0x0, 0x0, 0x0}},
+    {-161459, 1, {0x0, 0x0, 0x0}},
+    {-161404, 1, {0x0, 0x0, 0x0}},
+    {-161335, 1, {0x0, 0x0, 0x0}},
+    {-161262, 1, {0x0, 0x0, 0x0}},
+    {-161401, 1, {0x0, 0x0, 0x0}},
+    {-161248, 1, {0x0, 0x0, 0x0}},
+    {-161207, 1, {0x0, 0x0, 0x0}},
+    {-161096, 1, {0x0, 0x0, 0x0}},
+    {-161357, 1, {0x0, 0x0, 0x0}},
+    {-161239, 1, {0x0, 0x0, 0x0}},
+    {-161238, 1, {0x0, 0x0, 0x0}},
+    {-161223, 1, {0x0, 0x0, 0x0}},
+    {-36206, 1, {0x0, 0x0, 0x0}},
+    {-35898, 1, {0x0, 0x0, 0x0}},
+    {-36049, 1, {0x0, 0x0, 0x0}},
+    {-177276, 1, {0x0, 0x0, 0x0}},
+    {-160951, 1, {0x0, 0x0, 0x0}},
+    {-160950, 1, {0x0, 0x0, 0x0}},
+    {-160916, 1, {0x0, 0x0, 0x0}},
+    {-34273, 1, {0x0, 0x0, 0x0}},
+    {-160840, 1, {0x0, 0x0, 0x0}},
+    {-35457, 1, {0x0, 0x0, 0x0}},
+    {-177233, 1, {0x0, 0x0, 0x0}},
+    {-177230, 1, {0x0, 0x0, 0x0}},
+    {-35327, 1, {0x0, 0x0, 0x0}},
+    {-35039, 1, {0x0, 0x0, 0x0}},
+    {-177223, 1, {0x0, 0x0, 0x0}},
+    {-160611, 1, {0x0, 0x0, 0x0}},
+    {-160600, 1, {0x0, 0x0, 0x0}},
+    {-160590, 1, {0x0, 0x0, 0x0}},
+    {-160589, 1, {0x0, 0x0, 0x0}},
+    {-160526, 1, {0x0, 0x0, 0x0}},
+    {-160560, 1, {0x0, 0x0, 0x0}},
+    {-160427, 1, {0x0, 0x0, 0x0}},
+    {-160472, 1, {0x0, 0x0, 0x0}},
+    {-160322, 1, {0x0, 0x0, 0x0}},
+    {-160404, 1, {0x0, 0x0, 0x0}},
+    {-160338, 1, {0x0, 0x0, 0x0}},
+    {-160312, 1, {0x0, 0x0, 0x0}},
+    {-177128, 1, {0x0, 0x0, 0x0}},
+    {-160223, 1, {0x0, 0x0, 0x0}},
+    {-160192, 1, {0x0, 0x0, 0x0}},
+    {-177097, 1, {0x0, 0x0, 0x0}},
+    {-160099, 1, {0x0, 0x0, 0x0}},
+    {-160097, 1, {0x0, 0x0, 0x0}},
+    {-33630, 1, {0x0, 0x0, 0x0}},
+    {-159983, 1, {0x0, 0x0, 0x0}},
+    {-159977, 1, {0x0, 0x0, 0x0}},
+    {-177043, 1, {0x0, 0x0, 0x0}},
+    {-159951, 1, {0x0, 0x0, 0x0}},
+    {-181519, 1, {0x0, 0x0, 0x0}},
+    {-33053, 1, {0x0, 0x0, 0x0}},
+    {-32870, 1, {0x0, 0x0, 0x0}},
+    {-176911, 1, {0x0, 0x0, 0x0}},
+    {-176903, 1, {0x0, 0x0, 0x0}},
+    {-159535, 1, {0x0, 0x0, 0x0}},
+    {-159459, 1, {0x0, 0x0, 0x0}},
+    {-159303, 1, {0x0, 0x0, 0x0}},
+    {-159101, 1, {0x0, 0x0, 0x0}},
+    {-32043, 1, {0x0, 0x0, 0x0}},
+    {-159017, 1, {0x0, 0x0, 0x0}},
+    {-158996, 1, {0x0, 0x0, 0x0}},
+    {-158907, 1, {0x0, 0x0, 0x0}},
+    {-158816, 1, {0x0, 0x0, 0x0}},
+    {-31401, 1, {0x0, 0x0, 0x0}},
+    {-61909, 1, {0x0, 0x0, 0x0}},
+    {-158735, 1, {0x0, 0x0, 0x0}},
+    {-158751, 1, {0x0, 0x0, 0x0}},
+    {-158700, 1, {0x0, 0x0, 0x0}},
+    {-61695, 1, {0x0, 0x0, 0x0}},
+    {-158474, 1, {0x0, 0x0, 0x0}},
+    {-158375, 1, {0x0, 0x0, 0x0}},
+    {-29684, 1, {0x0, 0x0, 0x0}},
+    {-158030, 1, {0x0, 0x0, 0x0}},
+    {-157938, 1, {0x0, 0x0, 0x0}},
+    {-157907, 1, {0x0, 0x0, 0x0}},
+    {-29367, 1, {0x0, 0x0, 0x0}},
+    {-157899, 1, {0x0, 0x0, 0x0}},
+    {-157615, 1, {0x0, 0x0, 0x0}},
+    {-157457, 1, {0x0, 0x0, 0x0}},
+    {-157550, 1, {0x0, 0x0, 0x0}},
+    {-157170, 1, {0x0, 0x0, 0x0}},
+    {-157143, 1, {0x0, 0x0, 0x0}},
+    {-28147, 1, {0x0, 0x0, 0x0}},
+    {-156771, 1, {0x0, 0x0, 0x0}},
+    {-176218, 1, {0x0, 0x0, 0x0}},
+    {-156729, 1, {0x0, 0x0, 0x0}},
+    {-27770, 1, {0x0, 0x0, 0x0}},
+    {-176140, 1, {0x0, 0x0, 0x0}},
+    {-156464, 1, {0x0, 0x0, 0x0}},
+    {-171074, 1, {0x0, 0x0, 0x0}},
+    {-156370, 1, {0x0, 0x0, 0x0}},
+    {-26801, 1, {0x0, 0x0, 0x0}},
+    {-26589, 1, {0x0, 0x0, 0x0}},
+    {-176010, 1, {0x0, 0x0, 0x0}},
+    {-176003, 1, {0x0, 0x0, 0x0}},
+    {-156186, 1, {0x0, 0x0, 0x0}},
+    {-26097, 1, {0x0, 0x0, 0x0}},
+    {-175946, 1, {0x0, 0x0, 0x0}},
+    {-25959, 1, {0x0, 0x0, 0x0}},
+    {-156147, 1, {0x0, 0x0, 0x0}},
+    {-156148, 1, {0x0, 0x0, 0x0}},
+    {-156119, 1, {0x0, 0x0, 0x0}},
+    {-25675, 1, {0x0, 0x0, 0x0}},
+    {-155936, 1, {0x0, 0x0, 0x0}},
+    {-175824, 1, {0x0, 0x0, 0x0}},
+    {-155867, 1, {0x0, 0x0, 0x0}},
+    {-155742, 1, {0x0, 0x0, 0x0}},
+    {-155716, 1, {0x0, 0x0, 0x0}},
+    {-155657, 1, {0x0, 0x0, 0x0}},
+    {-175674, 1, {0x0, 0x0, 0x0}},
+    {-24281, 1, {0x0, 0x0, 0x0}},
+    {-155384, 1, {0x0, 0x0, 0x0}},
+    {-155083, 1, {0x0, 0x0, 0x0}},
+    {-154895, 1, {0x0, 0x0, 0x0}},
+    {-175423, 1, {0x0, 0x0, 0x0}},
+    {-175393, 1, {0x0, 0x0, 0x0}},
+    {-154792, 1, {0x0, 0x0, 0x0}},
+    {-22850, 1, {0x0, 0x0, 0x0}},
+    {-175385, 1, {0x0, 0x0, 0x0}},
+    {-22797, 1, {0x0, 0x0, 0x0}},
+    {-22533, 1, {0x0, 0x0, 0x0}},
+    {-22403, 1, {0x0, 0x0, 0x0}},
+    {-154458, 1, {0x0, 0x0, 0x0}},
+    {-175296, 1, {0x0, 0x0, 0x0}},
+    {-154398, 1, {0x0, 0x0, 0x0}},
+    {-154394, 1, {0x0, 0x0, 0x0}},
+    {-154388, 1, {0x0, 0x0, 0x0}},
+    {-154379, 1, {0x0, 0x0, 0x0}},
+    {-154373, 1, {0x0, 0x0, 0x0}},
+    {-154337, 1, {0x0, 0x0, 0x0}},
+    {-21533, 1, {0x0, 0x0, 0x0}},
+};
+
+inline constexpr uint16_t stage1[4352] = {
+    0, 1, 2, 3, 4, 5, 6, 6, 6, 7, 8, 9, 6, 6, 6, 10,
+    11, 6, 6, 12, 6, 6, 6, 6, 6, 6, 6, 6, 13, 6, 14, 15,
+    16, 17, 18, 19, 20, 6, 6, 6, 6, 6, 21, 6, 22, 6, 6, 6,
+    23, 6, 24, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 25, 26, 6, 6, 6, 27, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 28, 29, 30, 6, 6, 6, 31,
+    6, 6, 6, 6, 32, 33, 6, 6, 6, 6, 6, 6, 34, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 35, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 36, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 37, 6, 6, 38, 39, 40, 41, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 42, 6, 6, 6, 6, 43, 6,
+    6, 44, 45, 6, 6, 6, 6, 6, 6, 6, 6, 46, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 47, 48, 49, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+};
+
+inline constexpr uint16_t stage2[12800] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 4, 5, 6, 7, 8, 1, 8, 7, 8, 9, 10, 7, 8, 9, 10,
+    1, 7, 7, 8, 9, 10, 11, 0, 1, 8, 9, 10, 11, 8, 1, 12,
+    13, 14, 15, 16, 17, 18, 0, 18, 17, 18, 19, 20, 17, 18, 19, 20,
+    0, 17, 17, 18, 19, 20, 21, 0, 0, 18, 19, 20, 21, 18, 0, 20,
+    22, 23, 24, 25, 26, 27, 26, 27, 28, 29, 30, 31, 32, 33, 33, 34,
+    35, 0, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 44, 45, 46, 47,
+    48, 49, 50, 51, 51, 52, 35, 0, 53, 54, 55, 56, 57, 58, 59, 60,
+    61, 0, 35, 0, 62, 63, 63, 64, 0, 65, 66, 67, 68, 69, 70, 35,
+    0, 35, 0, 71, 72, 73, 74, 75, 76, 77, 35, 0, 78, 79, 80, 81,
+    82, 83, 35, 0, 83, 84, 85, 86, 87, 88, 88, 89, 90, 91, 92, 93,
+    94, 95, 95, 96, 97, 98, 35, 0, 99, 100, 101, 102, 103, 104, 105, 106,
+    107, 108, 109, 110, 109, 110, 109, 110, 111, 111, 112, 113, 114, 115, 116, 117,
+    0, 118, 35, 0, 35, 0, 119, 35, 0, 120, 120, 35, 0, 0, 121, 122,
+    123, 35, 0, 120, 124, 0, 125, 126, 35, 0, 0, 0, 125, 127, 0, 128,
+    129, 130, 35, 0, 35, 0, 131, 35, 0, 131, 0, 0, 35, 0, 131, 132,
+    133, 134, 134, 35, 0, 35, 0, 135, 35, 0, 0, 0, 35, 0, 0, 0,
+    0, 0, 0, 0, 136, 35, 0, 136, 35, 0, 136, 35, 0, 137, 138, 139,
+    140, 141, 142, 143, 144, 145, 146, 141, 142, 147, 148, 139, 140, 0, 149, 150,
+    151, 152, 108, 109, 35, 0, 151, 152, 149, 150, 153, 154, 149, 150, 155, 156,
+    157, 136, 35, 0, 158, 159, 5, 160, 161, 162, 163, 164, 165, 166, 167, 168,
+    169, 170, 171, 172, 169, 170, 171, 172, 169, 170, 171, 172, 173, 174, 169, 170,
+    174, 169, 170, 171, 169, 170, 171, 172, 175, 176, 176, 177, 35, 0, 178, 179,
+    16, 0, 35, 0, 35, 0, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 191, 192, 193, 0, 0, 0, 0, 0, 0, 194, 35, 0, 26, 195, 0,
+    0, 35, 0, 57, 196, 197, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 199, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    35, 0, 35, 0, 50, 0, 35, 0, 0, 0, 0, 0, 0, 0, 200, 199,
+    0, 0, 0, 0, 0, 201, 202, 203, 204, 205, 206, 0, 207, 0, 208, 209,
+    210, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 211, 212, 213, 214, 215, 216,
+    217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 218, 219, 220, 221, 222, 214,
+    223, 224, 0, 225, 226, 227, 228, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    229, 230, 0, 0, 231, 232, 0, 35, 0, 233, 35, 0, 0, 16, 16, 16,
+    234, 235, 236, 237, 236, 236, 236, 121, 236, 236, 236, 236, 205, 202, 234, 236,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 238, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 225, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    239, 240, 0, 241, 0, 0, 0, 225, 0, 0, 0, 0, 242, 243, 239, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 225, 226, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    211, 244, 245, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 0,
+    23, 24, 25, 26, 35, 0, 24, 25, 35, 0, 225, 226, 29, 30, 30, 31,
+    35, 0, 33, 34, 246, 36, 31, 32, 35, 0, 225, 226, 22, 23, 34, 246,
+    36, 37, 38, 39, 36, 37, 35, 0, 36, 37, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    0, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 247, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 248, 249, 250, 251, 252, 253, 254, 255,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 257, 0, 258,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 259, 0, 0, 260, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 261, 262, 263, 0, 0, 264, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 265, 266, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 268, 0, 0,
+    0, 0, 269, 0, 0, 0, 0, 270, 0, 0, 0, 0, 271, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 272, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 273, 0, 274, 275, 0, 276, 0, 0, 0, 0, 0, 0, 0,
+    0, 277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 279, 0, 0,
+    0, 0, 280, 0, 0, 0, 0, 281, 0, 0, 0, 0, 282, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284,
+    284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284,
+    284, 284, 284, 284, 284, 284, 0, 284, 0, 0, 0, 0, 0, 284, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 221, 221, 221, 221, 221, 221, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    285, 286, 287, 288, 288, 289, 290, 291, 292, 0, 0, 0, 0, 0, 0, 0,
+    293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+    293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293,
+    293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 293, 0, 0, 293, 293, 293,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    294, 295, 295, 296, 297, 298, 299, 300, 300, 301, 301, 302, 303, 304, 305, 306,
+    307, 308, 309, 310, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 319, 320,
+    320, 321, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 330, 331, 332, 333,
+    332, 333, 334, 335, 336, 337, 337, 338, 339, 340, 341, 342, 343, 344, 344, 345,
+    346, 347, 348, 349, 349, 350, 351, 352, 353, 354, 355, 356, 356, 357, 358, 359,
+    360, 361, 362, 363, 363, 364, 365, 366, 365, 366, 367, 368, 369, 370, 371, 372,
+    372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 381, 382, 383, 384, 385, 386,
+    387, 388, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 397, 398, 399, 400,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 409, 410, 411, 412, 412, 413,
+    413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 0, 0, 12, 0,
+    425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440,
+    441, 442, 443, 444, 445, 446, 447, 448, 445, 446, 447, 448, 449, 450, 451, 452,
+    453, 454, 455, 456, 457, 458, 459, 460, 457, 458, 459, 460, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+    475, 476, 477, 478, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+    485, 486, 483, 484, 485, 486, 487, 488, 489, 490, 35, 0, 35, 0, 35, 0,
+    491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+    503, 504, 505, 506, 507, 508, 0, 0, 509, 510, 511, 512, 513, 514, 0, 0,
+    515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+    529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+    539, 540, 541, 542, 543, 544, 0, 0, 545, 546, 547, 548, 549, 550, 0, 0,
+    547, 548, 549, 550, 551, 552, 553, 554, 0, 555, 0, 556, 0, 557, 0, 558,
+    559, 557, 560, 558, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572,
+    573, 574, 575, 576, 575, 576, 575, 576, 577, 578, 579, 580, 581, 582, 0, 0,
+    583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+    584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584,
+    585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+    586, 587, 583, 583, 583, 0, 588, 583, 589, 590, 591, 592, 583, 0, 588, 0,
+    0, 593, 584, 584, 584, 0, 594, 584, 595, 596, 595, 596, 584, 597, 227, 598,
+    599, 600, 601, 602, 0, 0, 603, 604, 605, 606, 607, 608, 0, 609, 1, 238,
+    610, 611, 603, 604, 612, 613, 607, 608, 612, 613, 614, 615, 616, 617, 618, 619,
+    0, 0, 585, 585, 585, 0, 620, 585, 621, 622, 623, 624, 585, 625, 0, 0,
+    136, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 626, 0, 0, 0, 0, 0, 0, 0, 627, 627, 628, 629, 630, 631,
+    632, 633, 630, 632, 0, 632, 0, 0, 0, 634, 634, 634, 635, 636, 0, 0,
+    0, 0, 0, 0, 635, 0, 637, 0, 638, 0, 639, 640, 640, 640, 0, 640,
+    641, 641, 642, 643, 644, 0, 0, 0, 0, 645, 0, 0, 646, 647, 648, 649,
+    126, 0, 0, 0, 0, 650, 651, 651, 652, 652, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653, 653,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654, 655, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 656, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 657, 658, 657,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 225, 0, 0, 0, 0, 225, 0, 0, 225, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 225, 0, 225, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 222, 0, 0, 225, 0, 0, 226, 0, 225, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    659, 0, 225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 241, 660, 661,
+    662, 662, 0, 0, 226, 226, 0, 0, 226, 226, 0, 0, 0, 0, 0, 0,
+    219, 219, 0, 0, 226, 226, 0, 0, 226, 226, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 654, 222, 222, 663,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 664, 664, 0, 0, 0, 0, 0, 0, 160, 160, 160, 160, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 665, 665, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    666, 666, 666, 666, 666, 666, 666, 666, 666, 667, 668, 669, 670, 671, 672, 673,
+    674, 675, 676, 677, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678,
+    678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678, 678,
+    679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 679,
+    679, 679, 679, 679, 679, 679, 679, 679, 679, 679, 680, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 0, 681, 682, 683, 0, 0, 35, 0, 35, 0, 35, 0, 684, 685, 686,
+    687, 0, 35, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 688, 688,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 35, 0, 0,
+    0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 690, 691, 692, 693, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708,
+    709, 710, 710, 711, 711, 711, 712, 713, 713, 714, 714, 714, 714, 714, 715, 716,
+    717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 0,
+    732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747,
+    748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763,
+    764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
+    780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    796, 797, 798, 799, 800, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810,
+    811, 812, 813, 814, 815, 815, 815, 815, 815, 815, 816, 817, 818, 819, 820, 820,
+    820, 820, 820, 821, 822, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    0, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 35, 0, 825, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 0, 0, 0, 35, 0, 826, 0, 0,
+    35, 0, 35, 0, 0, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 827, 828, 829, 830, 827, 0,
+    831, 832, 833, 834, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0, 35, 0,
+    35, 0, 35, 0, 230, 835, 836, 35, 0, 35, 0, 0, 0, 0, 0, 0,
+    35, 0, 0, 0, 0, 0, 35, 0, 35, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837,
+    837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837,
+    837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837,
+    837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837,
+    837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853,
+    854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869,
+    870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885,
+    886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901,
+    902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917,
+    918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933,
+    934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949,
+    950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 863, 964,
+    965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980,
+    981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996,
+    997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012,
+    1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+    1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+    1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
+    1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+    1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
+    1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 0, 0,
+    1107, 0, 1108, 0, 0, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 0,
+    1119, 0, 1120, 0, 0, 1121, 1122, 0, 0, 0, 1123, 1124, 1125, 1126, 1127, 1128,
+    1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1025, 1141, 1142, 1143,
+    1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1075, 1153, 1154, 1155, 1156, 1157, 1158,
+    1159, 1160, 1161, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
+    1174, 1175, 1176, 1120, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 0, 0,
+    1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 995, 1135, 1197, 1198, 1199, 1200,
+    1201, 1202, 1203, 1204, 1205, 1206, 1000, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+    1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+    1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
+    1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+    1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+    1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1290, 1291, 1292, 1293, 1294, 1295, 1295, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1296, 1297, 1298, 1299, 1300, 0, 0, 0, 0, 0, 1301, 0, 1302,
+    1303, 1304, 1305, 1305, 1306, 1306, 1306, 1307, 1303, 1308, 1309, 1310, 1311, 1312, 1313, 1314,
+    1315, 1316, 1317, 1318, 1319, 1320, 1321, 0, 1322, 1323, 1324, 1325, 1326, 0, 1327, 0,
+    1328, 1329, 0, 1330, 1331, 0, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341,
+    1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341,
+    1341, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342,
+    1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1342, 1341, 1341, 1341, 1341, 1341,
+    1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341,
+    1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1343,
+    1343, 1344, 1345, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357,
+    1348, 1358, 1359, 1360, 1361, 1362, 1362, 1363, 1364, 1365, 1366, 1349, 1350, 1351, 1352, 1353,
+    1367, 1368, 1369, 1370, 1371, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1374, 1375, 1376, 1377,
+    1377, 1377, 1377, 1377, 1378, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1381, 1382, 1383, 1383,
+    1384, 1385, 1385, 1386, 1387, 1386, 1386, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389,
+    1390, 1391, 1391, 1391, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 0,
+    0, 0, 1394, 1394, 1394, 1394, 1394, 1394, 0, 0, 1395, 1395, 1395, 1395, 1395, 1395,
+    0, 0, 1396, 1396, 1396, 1396, 1396, 1396, 0, 0, 1397, 1397, 1397, 0, 0, 0,
+    1398, 1398, 1399, 1400, 1398, 1401, 1402, 0, 1403, 1404, 1404, 1404, 1404, 1405, 1406, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+    1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+    1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+    1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+    1407, 1407, 1407, 1407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 0, 1408, 1408, 1408, 1408,
+    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 0, 1408, 1408, 1408, 1408,
+    1408, 1408, 1408, 0, 1408, 1408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409,
+    1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409,
+    1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409, 1409,
+    1409, 1409, 1409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1410, 1411,
+    1412, 1413, 1414, 1415, 1416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1417, 1418, 1419, 1420, 1421,
+    1422, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423,
+    1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1423, 1424, 1424, 1424, 1424, 1424, 1424,
+    1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,
+    1424, 1424, 1424, 1424, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
+    1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426,
+    1426, 1426, 1426, 1426, 1426, 0, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+    1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+    1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+    1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+    1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 0, 1429, 1429,
+    0, 0, 1429, 0, 0, 1429, 1429, 0, 0, 1429, 1429, 1429, 1429, 0, 1429, 1429,
+    1429, 1429, 1429, 1429, 1429, 1429, 1430, 1430, 1430, 1430, 0, 1430, 0, 1430, 1430, 1430,
+    1430, 1430, 1430, 1430, 0, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
+    1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+    1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1432, 1432, 1432, 1432, 1432, 1432,
+    1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
+    1432, 1432, 1432, 1432, 1433, 1433, 0, 1433, 1433, 1433, 1433, 0, 0, 1433, 1433, 1433,
+    1433, 1433, 1433, 1433, 1433, 0, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 0, 1434, 1434,
+    1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434,
+    1434, 1434, 1434, 1434, 1434, 1434, 1434, 1434, 1435, 1435, 0, 1435, 1435, 1435, 1435, 0,
+    1435, 1435, 1435, 1435, 1435, 0, 1435, 0, 0, 0, 1435, 1435, 1435, 1435, 1435, 1435,
+    1435, 0, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436,
+    1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437,
+    1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+    1437, 1437, 1437, 1437, 1437, 1437, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
+    1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438,
+    1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+    1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1440, 1440, 1440, 1440, 1440, 1440,
+    1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440,
+    1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+    1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1442, 1442,
+    1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
+    1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+    1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+    1443, 1443, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444,
+    1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1445, 1445, 1445,
+    1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+    1445, 1445, 1445, 1445, 1445, 1445, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
+    1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446,
+    1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447,
+    1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448,
+    1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+    1448, 1448, 1448, 1448, 1441, 1449, 0, 0, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+    1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451, 1450, 1450, 1450, 1450, 1450, 1450,
+    1450, 1452, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453,
+    1453, 1453, 1453, 1454, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1455, 1456, 1457, 1458, 1459,
+    1460, 1461, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462,
+    1462, 1462, 1462, 1463, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1464, 1465, 1465, 1465, 1465,
+    1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1465, 1465,
+    1465, 1465, 1465, 1465, 1465, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1474, 1474, 1474,
+    1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1475, 1474, 1474,
+    1474, 1474, 1474, 1474, 1474, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+    1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1479,
+    1480, 1481, 1482, 1483, 1484, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+    1486, 1486, 1486, 1486, 1486, 1486, 1486, 1487, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1488,
+    1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489,
+    1489, 1490, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1491, 1492, 1425, 1493, 1494, 1495, 1496,
+    1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497,
+    1497, 1498, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1499, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1501, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1502, 1503, 1504, 1505, 1506, 1427, 1507, 1426, 1508, 0, 0, 1509, 1509,
+    1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510,
+    1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1512, 1512, 1512, 1512,
+    1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+    1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+    1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+    1514, 1514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1515, 1515, 1516, 1517, 0, 1518, 1517, 1519, 1520, 1521, 1522, 1522, 1522, 1522, 1523, 1516,
+    1524, 1525, 1526, 1527, 1528, 1529, 1529, 1530, 1531, 1532, 1527, 1533, 1534, 1535, 1536, 1537,
+    0, 1538, 1539, 0, 1540, 0, 0, 1541, 0, 1542, 1543, 1543, 1543, 1543, 1544, 1539,
+    1545, 1546, 1547, 0, 1548, 1549, 1549, 1550, 0, 1551, 0, 1552, 0, 0, 0, 0,
+    0, 0, 1553, 0, 0, 0, 0, 1554, 0, 1555, 0, 1556, 0, 1556, 1557, 1553,
+    0, 1558, 1559, 0, 1560, 0, 0, 1561, 0, 1562, 0, 1563, 0, 1564, 0, 1547,
+    0, 1565, 1566, 0, 1567, 0, 0, 1568, 1569, 1570, 1571, 0, 1571, 1571, 1572, 1566,
+    1573, 1574, 1575, 0, 1576, 1577, 1577, 1578, 0, 1579, 1580, 1581, 1582, 0, 1540, 0,
+    1583, 1583, 1584, 1585, 1586, 1586, 1585, 1587, 1588, 1589, 0, 1590, 1590, 1590, 1591, 1584,
+    1592, 1593, 1594, 1595, 1596, 1597, 1597, 1598, 1599, 1600, 1595, 1601, 0, 0, 0, 0,
+    0, 1602, 1603, 1604, 0, 1605, 1604, 1606, 1607, 1608, 0, 1609, 1609, 1609, 1610, 1603,
+    1611, 1612, 1613, 1614, 1615, 1616, 1616, 1617, 1618, 1619, 1614, 1620, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1621, 1622, 1623, 1624, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1625, 1626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 0, 0, 0, 0, 0, 0,
+    1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643,
+    1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659,
+    1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1669, 1670, 1671, 1672, 1673, 1674,
+    1675, 1676, 1675, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689,
+    1686, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+    1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720,
+    1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736,
+    1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1748, 1750, 1751,
+    1752, 1753, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766,
+    1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782,
+    1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798,
+    1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814,
+    1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830,
+    1831, 1832, 1833, 1834, 1827, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845,
+    1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861,
+    1862, 1863, 1864, 1865, 1866, 1867, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876,
+    1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892,
+    1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908,
+    1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
+    1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940,
+    1941, 1942, 1943, 1944, 1945, 1946, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955,
+    1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971,
+    1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987,
+    1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003,
+    2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+    2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035,
+    2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051,
+    2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067,
+    2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
+    2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099,
+    1119, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2107, 2108, 2109, 2110, 2111, 2112, 2113,
+    2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129,
+    2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145,
+    2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline const Value& lookup(char32_t cp) {
+    return values[stage2[(stage1[cp >> BLOCK_SHIFT] << BLOCK_SHIFT) | (cp & 0xFF)]];
+}
+
+} // namespace forword_fold
+
+#endif // FORWORD_FOLD_TABLE_H
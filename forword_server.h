@@ -0,0 +1,535 @@
+#ifndef FORWORD_SERVER_H
+#define FORWORD_SERVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "forword.h"
+#include "forword_client.h"
+
+// The engine behind forwordd: serves search, replace and find_all for one
+// dictionary over a Unix domain socket, in the wire format described in
+// forword_client.h.
+//
+// One thread runs a poll() loop over every connection and parses requests
+// into a pending list; a scan thread takes the whole list as one batch and
+// runs it on a ThreadPool through search_batch(), replace_batch() and
+// find_all(). While a batch is scanning, requests from all connections keep
+// piling up, so the batch size follows the load: an idle daemon answers a
+// lone request at once, a busy one scans thousands per batch. Each batch
+// scans one snapshot of the Reloadable, so a reload takes effect from the
+// next batch on.
+class ForwordServer {
+public:
+    struct Options {
+        // Scan threads; 0 uses every core.
+        size_t threads{0};
+
+        // Stop reading new requests while this many request bytes wait for
+        // the scan threads.
+        size_t max_pending_bytes{64 * 1024 * 1024};
+    };
+
+    // A connection is not read while it has this many requests unanswered or
+    // this many response bytes unsent, so a client that never reads cannot
+    // grow the daemon's memory.
+    static constexpr size_t MAX_IN_FLIGHT = 4 * ForwordClient::PIPELINE_DEPTH;
+    static constexpr size_t MAX_OUTBOX = 16 * 1024 * 1024;
+
+    struct Stats {
+        uint64_t connections;
+        uint64_t requests;
+        uint64_t batches;
+    };
+
+    ForwordServer(const Forword::Reloadable& dictionary, const std::string& socket_path)
+        : ForwordServer(dictionary, socket_path, Options()) {}
+
+    // Listens on socket_path. A stale socket file left by a daemon that is
+    // gone is replaced; a live one is an error.
+    ForwordServer(const Forword::Reloadable& dictionary, const std::string& socket_path, Options options)
+        : dictionary_(dictionary), socket_path_(socket_path), options_(options),
+          pool_(options.threads > 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency())) {
+        sockaddr_un address{};
+        if (socket_path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Socket path too long: " + socket_path);
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+        struct stat st;
+        if (::lstat(socket_path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+            int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            bool live = probe >= 0 && ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+            if (probe >= 0) ::close(probe);
+            if (live) {
+                throw std::runtime_error("forwordd is already listening on " + socket_path);
+            }
+            ::unlink(socket_path.c_str());
+        }
+
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd_ < 0 || !set_flags(listen_fd_) ||
+            ::bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(listen_fd_, SOMAXCONN) != 0) {
+            close_fds();
+            throw std::runtime_error("Failed to listen on " + socket_path);
+        }
+        bound_ = true;
+
+        if (::pipe(wake_) != 0 || !set_flags(wake_[0]) || !set_flags(wake_[1])) {
+            close_fds();
+            throw std::runtime_error("Failed to create wake pipe");
+        }
+    }
+
+    ~ForwordServer() {
+        close_fds();
+    }
+
+    ForwordServer(const ForwordServer&) = delete;
+    ForwordServer& operator=(const ForwordServer&) = delete;
+
+    // Serves until stop(). Connections still open are closed on return;
+    // requests they had in flight are dropped.
+    void run() {
+        std::thread scanner([this] { scan_loop(); });
+        std::vector<pollfd> fds;
+        std::vector<uint64_t> ids;
+
+        while (!stopping_.load()) {
+            fds.clear();
+            ids.clear();
+            fds.push_back({wake_[0], POLLIN, 0});
+            fds.push_back({listen_fd_, POLLIN, 0});
+            for (auto& [id, connection] : connections_) {
+                short events = 0;
+                if (readable(connection)) events |= POLLIN;
+                if (connection.sent < connection.out.size()) events |= POLLOUT;
+                // A negative fd is skipped, so a hangup on a connection that
+                // is not being read does not wake the loop over and over
+                fds.push_back({events != 0 ? connection.fd : -1, events, 0});
+                ids.push_back(id);
+            }
+
+            if (::poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+
+            if (fds[0].revents & POLLIN) {
+                char drain[64];
+                while (::read(wake_[0], drain, sizeof(drain)) > 0) {}
+                collect_responses();
+            }
+            if (fds[1].revents & POLLIN) {
+                accept_connections();
+            }
+            for (size_t k = 0; k < ids.size(); k++) {
+                short revents = fds[k + 2].revents;
+                if (revents == 0) continue;
+                auto it = connections_.find(ids[k]);
+                if (it == connections_.end()) continue;  // closed by collect_responses()
+                bool open = true;
+                if (revents & (POLLIN | POLLHUP | POLLERR)) open = read_requests(ids[k], it->second);
+                if (open && (revents & POLLOUT)) open = write_responses(it->second);
+                if (!open || finished(it->second)) {
+                    ::close(it->second.fd);
+                    connections_.erase(it);
+                }
+            }
+
+            dispatch();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            scanner_stop_ = true;
+        }
+        wake_scanner_.notify_all();
+        scanner.join();
+
+        for (auto& [id, connection] : connections_) {
+            ::close(connection.fd);
+        }
+        connections_.clear();
+        pending_.clear();
+    }
+
+    // Makes run() return. Safe to call from any thread, and only writes to
+    // a pipe, so a signal handler may call it too.
+    void stop() {
+        stopping_.store(true);
+        wake();
+    }
+
+    Stats stats() const {
+        return {connections_accepted_.load(), requests_.load(), batches_.load()};
+    }
+
+private:
+    struct Request {
+        uint64_t connection;
+        uint32_t id;
+        ForwordClient::Op op;
+        std::string replacement;
+        std::string text;
+        std::string error;  // answered with this error instead of scanned
+    };
+
+    struct Response {
+        uint64_t connection;
+        std::string frame;
+    };
+
+    struct Connection {
+        int fd{-1};
+        std::string in;      // bytes of requests not parsed yet
+        std::string out;     // response frames, sent up to sent
+        size_t sent{0};
+        size_t in_flight{0};  // requests parsed but not answered yet
+        bool closed{false};   // the client shut down its side
+    };
+
+    const Forword::Reloadable& dictionary_;
+    std::string socket_path_;
+    Options options_;
+    Forword::ThreadPool pool_;
+    int listen_fd_{-1};
+    int wake_[2]{-1, -1};
+    bool bound_{false};
+    std::atomic<bool> stopping_{false};
+
+    // Owned by the poll loop
+    std::unordered_map<uint64_t, Connection> connections_;
+    uint64_t next_connection_{0};
+    std::vector<Request> pending_;
+    size_t pending_bytes_{0};
+    bool scanning_{false};
+
+    // Handed between the poll loop and the scan thread
+    std::mutex mutex_;
+    std::condition_variable wake_scanner_;
+    std::vector<Request> batch_;
+    std::vector<Response> done_;
+    bool batch_ready_{false};
+    bool batch_done_{false};
+    bool scanner_stop_{false};
+
+    std::atomic<uint64_t> connections_accepted_{0};
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<uint64_t> batches_{0};
+
+    static bool set_flags(int fd) {
+        return ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK) == 0 &&
+               ::fcntl(fd, F_SETFD, FD_CLOEXEC) == 0;
+    }
+
+    void close_fds() {
+        if (listen_fd_ >= 0) {
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+        }
+        if (bound_) {
+            ::unlink(socket_path_.c_str());
+            bound_ = false;
+        }
+        for (int& fd : wake_) {
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+        }
+    }
+
+    void wake() {
+        char byte = 0;
+        [[maybe_unused]] ssize_t n = ::write(wake_[1], &byte, 1);
+    }
+
+    bool readable(const Connection& connection) const {
+        return !connection.closed && connection.in_flight < MAX_IN_FLIGHT &&
+               connection.out.size() - connection.sent < MAX_OUTBOX &&
+               pending_bytes_ < options_.max_pending_bytes;
+    }
+
+    static bool finished(const Connection& connection) {
+        return connection.closed && connection.in_flight == 0 && connection.sent == connection.out.size();
+    }
+
+    void accept_connections() {
+        for (;;) {
+            int fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0) {
+                if (errno == EINTR) continue;
+                return;
+            }
+            if (!set_flags(fd)) {
+                ::close(fd);
+                continue;
+            }
+            connections_[next_connection_++].fd = fd;
+            connections_accepted_++;
+        }
+    }
+
+    // Reads what the socket has and queues every complete request. Returns
+    // false when the connection has to be dropped.
+    bool read_requests(uint64_t id, Connection& connection) {
+        if (!readable(connection)) return true;  // a hangup while writing; send() reports it
+
+        constexpr size_t CHUNK = 64 * 1024;
+        size_t old_size = connection.in.size();
+        connection.in.resize(old_size + CHUNK);
+        ssize_t n = ::recv(connection.fd, connection.in.data() + old_size, CHUNK, 0);
+        connection.in.resize(old_size + (n > 0 ? static_cast<size_t>(n) : 0));
+        if (n == 0) {
+            connection.closed = true;
+        } else if (n < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+
+        size_t parsed = 0;
+        while (connection.in.size() - parsed >= 4) {
+            const char* frame = connection.in.data() + parsed;
+            uint32_t size = ForwordClient::get_u32(frame);
+            if (size < ForwordClient::FRAME_HEADER || size > ForwordClient::MAX_FRAME) return false;
+            if (connection.in.size() - parsed - 4 < size) break;
+
+            Request request{id, ForwordClient::get_u32(frame + 4), static_cast<ForwordClient::Op>(frame[8]), {}, {}, {}};
+            std::string_view payload(frame + 4 + ForwordClient::FRAME_HEADER, size - ForwordClient::FRAME_HEADER);
+            switch (request.op) {
+                case ForwordClient::Op::Search:
+                case ForwordClient::Op::FindAll:
+                    request.text = payload;
+                    break;
+                case ForwordClient::Op::Replace: {
+                    uint32_t length = payload.size() >= 4 ? ForwordClient::get_u32(payload.data()) : 0;
+                    if (payload.size() < 4 || payload.size() - 4 < length) {
+                        request.error = "malformed replace request";
+                        break;
+                    }
+                    request.replacement = payload.substr(4, length);
+                    request.text = payload.substr(4 + length);
+                    break;
+                }
+                default:
+                    request.error = "unknown op " + std::to_string(static_cast<unsigned>(frame[8] & 0xff));
+                    break;
+            }
+
+            pending_bytes_ += size;
+            connection.in_flight++;
+            pending_.push_back(std::move(request));
+            parsed += 4 + size;
+        }
+        connection.in.erase(0, parsed);
+        return true;
+    }
+
+    bool write_responses(Connection& connection) {
+        while (connection.sent < connection.out.size()) {
+            ssize_t n = ::send(connection.fd, connection.out.data() + connection.sent,
+                               connection.out.size() - connection.sent, ForwordClient::SEND_FLAGS);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+            connection.sent += static_cast<size_t>(n);
+        }
+        connection.out.clear();
+        connection.sent = 0;
+        return true;
+    }
+
+    // Hands the pending requests to the scan thread if it is idle.
+    void dispatch() {
+        if (scanning_ || pending_.empty()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batch_ = std::move(pending_);
+            batch_ready_ = true;
+        }
+        wake_scanner_.notify_one();
+        pending_.clear();
+        pending_bytes_ = 0;
+        scanning_ = true;
+    }
+
+    // Appends the finished batch's responses to their connections, in
+    // request order; connections closed meanwhile are skipped.
+    void collect_responses() {
+        std::vector<Response> responses;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!batch_done_) return;
+            responses = std::move(done_);
+            done_.clear();
+            batch_done_ = false;
+        }
+        scanning_ = false;
+        for (Response& response : responses) {
+            auto it = connections_.find(response.connection);
+            if (it == connections_.end()) continue;
+            it->second.out += response.frame;
+            it->second.in_flight--;
+        }
+        for (auto it = connections_.begin(); it != connections_.end();) {
+            if (!write_responses(it->second) || finished(it->second)) {
+                ::close(it->second.fd);
+                it = connections_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void scan_loop() {
+        for (;;) {
+            std::vector<Request> batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_scanner_.wait(lock, [&] { return batch_ready_ || scanner_stop_; });
+                if (scanner_stop_) return;
+                batch = std::move(batch_);
+                batch_.clear();
+                batch_ready_ = false;
+            }
+
+            std::vector<Response> responses = scan(batch);
+            requests_ += batch.size();
+            batches_++;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_ = std::move(responses);
+                batch_done_ = true;
+            }
+            wake();
+        }
+    }
+
+    static size_t begin_ok(std::string& frame, uint32_t id) {
+        return ForwordClient::begin_frame(frame, id, static_cast<uint8_t>(ForwordClient::Status::Ok));
+    }
+
+    static std::string error_frame(uint32_t id, std::string_view message) {
+        std::string frame;
+        size_t start = ForwordClient::begin_frame(frame, id, static_cast<uint8_t>(ForwordClient::Status::Error));
+        frame.append(message);
+        ForwordClient::end_frame(frame, start);
+        return frame;
+    }
+
+    // A request under MAX_FRAME can still get a larger answer (find_all
+    // sends 16 bytes and the word per match), which every client would
+    // reject as malformed and drop the connection; answer with an error.
+    static bool oversized(const std::string& frame, size_t start) {
+        return frame.size() - start - 4 > ForwordClient::MAX_FRAME;
+    }
+
+    static void end_ok(std::string& frame, size_t start, uint32_t id) {
+        if (oversized(frame, start)) {
+            frame.erase(start);
+            frame += error_frame(id, "response exceeds MAX_FRAME");
+            return;
+        }
+        ForwordClient::end_frame(frame, start);
+    }
+
+    // Runs one batch on the current dictionary snapshot. Searches and each
+    // distinct replacement go through the batch calls, which group small
+    // messages into tasks and split large ones across threads.
+    std::vector<Response> scan(const std::vector<Request>& batch) {
+        std::shared_ptr<const Forword> forword = dictionary_.snapshot();
+        std::vector<Response> responses(batch.size());
+        std::vector<size_t> searches;
+        std::vector<size_t> finds;
+        std::map<std::string_view, std::vector<size_t>> replaces;
+
+        for (size_t i = 0; i < batch.size(); i++) {
+            const Request& request = batch[i];
+            responses[i].connection = request.connection;
+            if (!request.error.empty()) {
+                responses[i].frame = error_frame(request.id, request.error);
+            } else if (request.op == ForwordClient::Op::Search) {
+                searches.push_back(i);
+            } else if (request.op == ForwordClient::Op::Replace) {
+                replaces[request.replacement].push_back(i);
+            } else {
+                finds.push_back(i);
+            }
+        }
+
+        auto run_group = [&](const std::vector<size_t>& group, auto&& scan_group) {
+            std::vector<std::string_view> texts;
+            for (size_t i : group) texts.push_back(batch[i].text);
+            try {
+                scan_group(texts);
+            } catch (const std::exception& e) {
+                for (size_t i : group) responses[i].frame = error_frame(batch[i].id, e.what());
+            }
+        };
+
+        run_group(searches, [&](const std::vector<std::string_view>& texts) {
+            std::vector<bool> found = forword->search_batch(texts, pool_);
+            for (size_t k = 0; k < searches.size(); k++) {
+                std::string& frame = responses[searches[k]].frame;
+                size_t start = begin_ok(frame, batch[searches[k]].id);
+                frame.push_back(found[k] ? 1 : 0);
+                end_ok(frame, start, batch[searches[k]].id);
+            }
+        });
+
+        for (const auto& [replacement, group] : replaces) {
+            run_group(group, [&](const std::vector<std::string_view>& texts) {
+                std::vector<std::string> replaced = forword->replace_batch(texts, pool_, replacement);
+                for (size_t k = 0; k < group.size(); k++) {
+                    std::string& frame = responses[group[k]].frame;
+                    size_t start = begin_ok(frame, batch[group[k]].id);
+                    frame += replaced[k];
+                    end_ok(frame, start, batch[group[k]].id);
+                }
+            });
+        }
+
+        pool_.parallel_for(finds.size(), [&](size_t k, size_t) {
+            const Request& request = batch[finds[k]];
+            std::string& frame = responses[finds[k]].frame;
+            try {
+                std::vector<Forword::Match> matches = forword->find_all(request.text);
+                size_t start = begin_ok(frame, request.id);
+                ForwordClient::put_u32(frame, static_cast<uint32_t>(matches.size()));
+                for (const Forword::Match& m : matches) {
+                    if (oversized(frame, start)) break;
+                    std::string_view word = forword->word(m.pattern_id);
+                    ForwordClient::put_u32(frame, static_cast<uint32_t>(m.begin));
+                    ForwordClient::put_u32(frame, static_cast<uint32_t>(m.end));
+                    ForwordClient::put_u32(frame, m.pattern_id);
+                    ForwordClient::put_u32(frame, static_cast<uint32_t>(word.size()));
+                    frame += word;
+                }
+                end_ok(frame, start, request.id);
+            } catch (const std::exception& e) {
+                frame = error_frame(request.id, e.what());
+            }
+        });
+
+        return responses;
+    }
+};
+
+#endif
@@ -1,8 +1,78 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <fstream>
 #include <filesystem>
+#include <random>
 #include "../forword.h"
 
+// Seeded linear congruential generator, so the property tests replay the
+// same random cases on every platform: next(n) is in [0, n)
+struct Lcg {
+    uint32_t seed;
+
+    uint32_t operator()(uint32_t n) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % n;
+    }
+};
+
+// Random word lists and texts for the property tests, drawn from alphabet;
+// words only from its first word_letters entries. With endings, every word
+// is listed once bare and once with each ending, so suffix states can merge.
+struct RandomCorpus {
+    std::vector<std::string> alphabet;
+    uint32_t word_letters;
+    uint32_t min_words, max_words;
+    uint32_t min_word_length, max_word_length;
+    uint32_t max_text_length;
+    std::vector<std::string> endings{};
+
+    std::string text(Lcg& next, uint32_t length, uint32_t letters = 0) const {
+        std::string text;
+        for (uint32_t k = 0; k < length; k++) text += alphabet[next(letters ? letters : alphabet.size())];
+        return text;
+    }
+
+    std::vector<std::string> words(Lcg& next) const {
+        std::vector<std::string> words;
+        for (uint32_t w = 0, count = min_words + next(max_words - min_words + 1); w < count; w++) {
+            std::string stem = text(next, min_word_length + next(max_word_length - min_word_length + 1), word_letters);
+            words.push_back(stem);
+            for (const auto& ending : endings) words.push_back(stem + ending);
+        }
+        return words;
+    }
+};
+
+// Expects two dictionaries to report the same matches in text
+void expect_same_matches(const Forword& a, const Forword& b, const std::string& text) {
+    auto x = a.find_all(text);
+    auto y = b.find_all(text);
+    ASSERT_EQ(x.size(), y.size()) << text;
+    for (size_t i = 0; i < x.size(); i++) {
+        EXPECT_EQ(x[i].begin, y[i].begin) << text;
+        EXPECT_EQ(x[i].end, y[i].end) << text;
+        EXPECT_EQ(x[i].pattern_id, y[i].pattern_id) << text;
+    }
+    EXPECT_EQ(a.search(text), b.search(text)) << text;
+    EXPECT_EQ(a.replace(text), b.replace(text)) << text;
+}
+
+// Collects what is written to std::cerr while it is in scope
+struct CapturedCerr {
+    std::stringstream text;
+    std::streambuf* old = std::cerr.rdbuf(text.rdbuf());
+    ~CapturedCerr() { std::cerr.rdbuf(old); }
+};
+
+// Loads a dictionary without printing warnings about the duplicate words
+// random word lists are full of
+template <typename... Args>
+Forword load_quietly(Args&&... args) {
+    CapturedCerr quiet;
+    return Forword(std::forward<Args>(args)...);
+}
+
 class ForwordTest : public ::testing::Test {
 protected:
     std::string temp_dir;
@@ -27,6 +97,24 @@ protected:
         // Clean up temporary files
         std::filesystem::remove_all(temp_dir);
     }
+
+    // Property test driver: each round writes a random word list from corpus
+    // to forbidden_words_file and calls check(words, text, next) with a
+    // random text; check may draw more cases from next
+    template <typename Check>
+    void for_random_dictionaries(uint32_t seed, int rounds, const RandomCorpus& corpus, Check&& check) {
+        Lcg next{seed};
+        for (int round = 0; round < rounds; round++) {
+            std::vector<std::string> words = corpus.words(next);
+            {
+                std::ofstream file(forbidden_words_file);
+                for (const auto& word : words) file << word << "\n";
+            }
+            std::string text = corpus.text(next, next(corpus.max_text_length + 1));
+            check(words, text, next);
+            if (::testing::Test::HasFatalFailure()) return;
+        }
+    }
 };
 
 TEST_F(ForwordTest, BasicSearch) {
@@ -62,11 +150,758 @@ TEST_F(ForwordTest, ReplaceKorean) {
     EXPECT_EQ(forword->replace("이것은 욕설 입니다"), "이것은 *** 입니다");
 }
 
+TEST_F(ForwordTest, OverlappingPatterns) {
+    // Classic Aho-Corasick dictionary: matches are only reachable through failure links
+    std::ofstream file(forbidden_words_file);
+    file << "he\nshe\nhis\nhers\n";
+    file.close();
+
+    Forword forword(forbidden_words_file);
+
+    EXPECT_TRUE(forword.search("ushers"));
+    EXPECT_TRUE(forword.search("ahisb"));
+    EXPECT_TRUE(forword.search("xshx he"));
+    EXPECT_FALSE(forword.search("shxrs"));
+
+    // Leftmost-longest: "she" starts first, so the overlapping "hers" is left alone
+    EXPECT_EQ(forword.replace("ushers"), "u *** rs");
+    EXPECT_EQ(forword.replace("his hers"), "*** ***");
+}
+
+TEST_F(ForwordTest, SharedSuffixPatterns) {
+    // Every pattern is a suffix of the longer ones; all are reported via dictionary links
+    std::ofstream file(forbidden_words_file);
+    file << "abcd\nbcd\ncd\nd\n";
+    file.close();
+
+    Forword forword(forbidden_words_file);
+
+    EXPECT_TRUE(forword.search("xxd"));
+    EXPECT_FALSE(forword.search("xxc"));
+    EXPECT_EQ(forword.replace("x abcd x"), "x *** x");
+    EXPECT_EQ(forword.replace("x bcd x"), "x *** x");
+}
+
+TEST_F(ForwordTest, ReplaceRepeatedWords) {
+    std::string text;
+    std::string expected;
+    for (int i = 0; i < 1000; i++) {
+        text += i % 2 ? "BAD  " : "badword ";
+        expected += i ? " ***" : "***";
+    }
+    EXPECT_EQ(forword->replace(text), expected);
+    EXPECT_EQ(forword->replace("bad  bad"), "*** ***");
+    EXPECT_EQ(forword->replace("xbadx"), "x *** x");
+}
+
+TEST_F(ForwordTest, LeftmostLongestMatchesReference) {
+    // Random dictionaries over a tiny alphabet, checked against a brute-force
+    // leftmost-longest selection
+    RandomCorpus corpus{{"a", "b", "c", "d"}, 3, 1, 8, 1, 6, 59};
+    for_random_dictionaries(42, 2000, corpus, [&](const std::vector<std::string>& words, const std::string& text, Lcg&) {
+        Forword forword = load_quietly(forbidden_words_file);
+
+        std::string expected;
+        size_t copied = 0;
+        for (size_t start = 0; start < text.size(); start++) {
+            size_t longest = 0;
+            for (const auto& word : words) {
+                if (word.size() > longest && text.compare(start, word.size(), word) == 0) longest = word.size();
+            }
+            if (longest == 0) continue;
+            expected += text.substr(copied, start - copied);
+            if (!expected.empty() && expected.back() != ' ') expected += ' ';
+            expected += "***";
+            if (start + longest < text.size()) expected += ' ';
+            copied = start + longest;
+            start = copied - 1;
+        }
+        expected += text.substr(copied);
+
+        EXPECT_EQ(forword.replace(text), expected) << text;
+    });
+
+    // A later, longer candidate must not evict a match it loses to: "xyz"
+    // beats "zab", which leaves the standalone "a" to be masked
+    std::ofstream file(forbidden_words_file);
+    file << "xyz\nzab\na\nqqqqq\n";
+    file.close();
+    Forword forword(forbidden_words_file);
+    EXPECT_EQ(forword.replace("xyzab"), "*** *** b");
+}
+
+TEST_F(ForwordTest, PrefilterMatchesFullScan) {
+    // Random dictionaries of two or more characters, so the prefilter is on,
+    // compared with a scan that runs the automaton over every position
+    RandomCorpus corpus{{"a", "b", "c", "-", u8"ä", u8"나"}, 3, 1, 5, 2, 5, 59};
+    Forword::Options full_scan;
+    full_scan.prefilter = false;
+
+    for_random_dictionaries(7, 50, corpus, [&](const std::vector<std::string>&, const std::string& text, Lcg&) {
+        Forword filtered = load_quietly(forbidden_words_file);
+        Forword unfiltered = load_quietly(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, full_scan);
+        ASSERT_GT(filtered.memory_usage().prefilter, 0u);
+        ASSERT_EQ(unfiltered.memory_usage().prefilter, 0u);
+        expect_same_matches(filtered, unfiltered, text);
+    });
+
+    // Single-character words turn the filter off
+    std::ofstream file(forbidden_words_file);
+    file << "x\nbad\n";
+    file.close();
+    Forword single(forbidden_words_file);
+    EXPECT_EQ(single.memory_usage().prefilter, 0u);
+    EXPECT_TRUE(single.search("a x b"));
+}
+
+TEST_F(ForwordTest, DenseDfaMatchesSparse) {
+    RandomCorpus corpus{{"a", "b", u8"나", u8"😀", "c", " "}, 4, 1, 6, 1, 4, 39};
+    Forword::Options sparse;
+    sparse.prefilter = false;
+    Forword::Options dense = sparse;
+    dense.dense_dfa_budget = 1 << 20;
+
+    for_random_dictionaries(11, 50, corpus, [&](const std::vector<std::string>&, const std::string& text, Lcg&) {
+        Forword reference = load_quietly(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, sparse);
+        Forword table = load_quietly(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, dense);
+        ASSERT_GT(table.memory_usage().dense_dfa, 0u);
+        expect_same_matches(table, reference, text);
+    });
+
+    // Rebuilt by compact() and for compiled dictionaries; skipped over budget
+    std::ofstream file(forbidden_words_file);
+    file << "bad\n";
+    file.close();
+    Forword::Options small = dense;
+    small.dense_dfa_budget = 64;
+    EXPECT_EQ(Forword(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, small).memory_usage().dense_dfa, 0u);
+
+    Forword table(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, dense);
+    table.add_word(u8"나쁜말");
+    table.compact();
+    EXPECT_GT(table.memory_usage().dense_dfa, 0u);
+    EXPECT_EQ(table.replace(u8"이건 나쁜 말, b a d"), u8"이건 *** , ***");
+
+    const std::string compiled_file = temp_dir + "/forbidden_words.fwd";
+    table.save_compiled(compiled_file);
+    Forword compiled(compiled_file, Forword::DEFAULT_IGNORED_SYMBOLS, dense);
+    EXPECT_GT(compiled.memory_usage().dense_dfa, 0u);
+    EXPECT_TRUE(compiled.search(u8"나쁜말"));
+}
+
+TEST_F(ForwordTest, ParallelBuildMatchesSerial) {
+    // Large enough for the parallel build, with case and accent duplicates
+    const uint32_t count = Forword::PARALLEL_BUILD_MIN_WORDS + 4000;
+    RandomCorpus corpus{{"a", "b", "c", "d", "e", "B", u8"é", u8"나", u8"쁜", u8"말", u8"я"}, 11, count, count, 2, 8, 49};
+
+    for_random_dictionaries(5, 1, corpus, [&](const std::vector<std::string>&, const std::string& text, Lcg& next) {
+        auto build = [&](size_t threads, std::string& warnings) {
+            Forword::Options options;
+            options.build_threads = threads;
+            CapturedCerr captured;
+            auto forword = std::make_unique<Forword>(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, options);
+            warnings = captured.text.str();
+            return forword;
+        };
+        std::string serial_warnings, parallel_warnings;
+        auto serial = build(1, serial_warnings);
+        auto parallel = build(4, parallel_warnings);
+
+        EXPECT_FALSE(serial_warnings.empty());
+        EXPECT_EQ(parallel_warnings, serial_warnings);
+        ASSERT_EQ(parallel->word_count(), serial->word_count());
+        for (uint32_t id = 0; id < serial->word_count(); id++) {
+            ASSERT_EQ(parallel->word(id), serial->word(id));
+        }
+        EXPECT_EQ(parallel->memory_usage().automaton, serial->memory_usage().automaton);
+        EXPECT_EQ(parallel->memory_usage().states, serial->memory_usage().states);
+
+        serial->add_word("zzz");
+        parallel->add_word("zzz");
+        serial->compact();
+        parallel->compact();
+        expect_same_matches(*parallel, *serial, text + " zzz");
+        for (int i = 0; i < 20; i++) {
+            expect_same_matches(*parallel, *serial, corpus.text(next, next(50)) + " zzz");
+        }
+    });
+}
+
+TEST_F(ForwordTest, MinimizedMatchesTrie) {
+    // Stems with shared endings, so many states merge
+    RandomCorpus corpus{{"a", "b", "c", u8"나", u8"쁜", u8"말", " ", "!"}, 8, 300, 300, 2, 4, 39,
+                        {u8"이에요", u8"인데", u8"이네", "ab", "ba"}};
+    Forword::Options options;
+    options.minimize = true;
+
+    for_random_dictionaries(9, 1, corpus, [&](const std::vector<std::string>&, const std::string& first_text, Lcg& next) {
+        Forword trie = load_quietly(forbidden_words_file);
+        Forword minimized = load_quietly(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, options);
+
+        auto usage = minimized.memory_usage();
+        EXPECT_EQ(usage.trie_states, trie.memory_usage().states);
+        EXPECT_EQ(usage.trie_automaton, trie.memory_usage().automaton);
+        EXPECT_LT(usage.states * 2, usage.trie_states);
+        EXPECT_LT(usage.automaton, usage.trie_automaton);
+        EXPECT_EQ(trie.memory_usage().trie_states, trie.memory_usage().states);
+
+        std::string text = first_text;
+        for (int i = 0; i < 200; i++) {
+            text.insert(next(text.size() + 1), corpus.endings[next(corpus.endings.size())]);
+            expect_same_matches(minimized, trie, text);
+            text = corpus.text(next, next(corpus.max_text_length + 1));
+        }
+
+        // Streaming, removals and compact() resolve IDs the same way
+        text = corpus.text(next, 400) + u8"이에요" + corpus.text(next, 400);
+        std::vector<uint32_t> streamed;
+        Forword::Scanner scanner(minimized);
+        scanner.on_match([&](const Forword::Match& m) { streamed.push_back(m.pattern_id); });
+        for (size_t i = 0; i < text.size(); i += 7) scanner.feed(std::string_view(text).substr(i, 7));
+        scanner.finish();
+        std::vector<uint32_t> expected;
+        for (const auto& m : trie.find_all(text)) expected.push_back(m.pattern_id);
+        EXPECT_EQ(streamed, expected);
+
+        ASSERT_FALSE(expected.empty());
+        std::string removed(trie.word(expected[0]));
+        EXPECT_TRUE(minimized.remove_word(removed));
+        EXPECT_FALSE(minimized.remove_word(removed));
+        EXPECT_TRUE(trie.remove_word(removed));
+        EXPECT_TRUE(minimized.add_word(u8"새말"));
+        EXPECT_TRUE(trie.add_word(u8"새말"));
+        expect_same_matches(minimized, trie, text + u8"새말");
+        EXPECT_FALSE(minimized.search(removed));
+
+        minimized.compact();
+        trie.compact();
+        EXPECT_LT(minimized.memory_usage().states, trie.memory_usage().states);
+        expect_same_matches(minimized, trie, text + u8"새말");
+
+        const std::string compiled_file = temp_dir + "/minimized.fwd";
+        minimized.save_compiled(compiled_file);
+        Forword compiled(compiled_file);
+        EXPECT_TRUE(compiled.memory_usage().mapped);
+        EXPECT_EQ(compiled.memory_usage().states, minimized.memory_usage().states);
+        EXPECT_EQ(compiled.memory_usage().trie_states, minimized.memory_usage().trie_states);
+        expect_same_matches(compiled, trie, text + u8"새말");
+
+        // Together with the dense DFA
+        Forword::Options dense_options = options;
+        dense_options.dense_dfa_budget = 64 << 20;
+        Forword dense(compiled_file, Forword::DEFAULT_IGNORED_SYMBOLS, dense_options);
+        EXPECT_GT(dense.memory_usage().dense_dfa, 0u);
+        expect_same_matches(dense, trie, text);
+    });
+}
+
+TEST_F(ForwordTest, FindAll) {
+    std::string text = "This is a b-a-d word, 나쁜말!";
+    auto matches = forword->find_all(text);
+
+    // "bad", the overlapping "badword", then "나쁜말"
+    ASSERT_EQ(matches.size(), 3u);
+    EXPECT_EQ(text.substr(matches[0].begin, matches[0].end - matches[0].begin), "b-a-d");
+    EXPECT_EQ(forword->word(matches[0].pattern_id), "bad");
+    EXPECT_EQ(text.substr(matches[1].begin, matches[1].end - matches[1].begin), "b-a-d word");
+    EXPECT_EQ(forword->word(matches[1].pattern_id), "badword");
+    EXPECT_EQ(text.substr(matches[2].begin, matches[2].end - matches[2].begin), "나쁜말");
+    EXPECT_EQ(forword->word(matches[2].pattern_id), "나쁜말");
+    EXPECT_EQ(forword->word_count(), 4u);
+
+    // Early exit after the first hit
+    size_t seen = 0;
+    EXPECT_FALSE(forword->find_all(text, [&](const Forword::Match&) { return ++seen < 1; }));
+    EXPECT_EQ(seen, 1u);
+
+    EXPECT_TRUE(forword->find_all("nothing here").empty());
+}
+
+TEST_F(ForwordTest, CompiledDictionary) {
+    const std::string compiled_file = temp_dir + "/forbidden_words.fwd";
+    forword->save_compiled(compiled_file);
+    Forword compiled(compiled_file);
+
+    ASSERT_EQ(compiled.word_count(), forword->word_count());
+    for (uint32_t id = 0; id < compiled.word_count(); id++) {
+        EXPECT_EQ(compiled.word(id), forword->word(id));
+    }
+    const char* texts[] = {"This is a b-a-d word", "이것은 나쁜말 입니다", "clean", "ＢＡＤ 욕설 badword"};
+    for (const char* text : texts) {
+        EXPECT_EQ(compiled.search(text), forword->search(text)) << text;
+        EXPECT_EQ(compiled.replace(text), forword->replace(text)) << text;
+        EXPECT_EQ(compiled.find_all(text).size(), forword->find_all(text).size()) << text;
+    }
+
+    // Damaged files are rejected instead of mapped
+    std::string bytes;
+    {
+        std::ifstream in(compiled_file, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    auto write_file = [&](const std::string& content) {
+        std::ofstream out(compiled_file, std::ios::binary | std::ios::trunc);
+        out << content;
+    };
+    write_file(bytes.substr(0, bytes.size() / 2));
+    EXPECT_THROW(Forword{compiled_file}, std::runtime_error);
+    std::string bad_version = bytes;
+    bad_version[8] = 99;
+    write_file(bad_version);
+    EXPECT_THROW(Forword{compiled_file}, std::runtime_error);
+
+    // So are files whose tables fit but hold an index out of range: overwrite
+    // the middle entry of each uint32 table. The table directory (offset and
+    // count per table) follows the 64-byte fixed part of the header.
+    for (int table : {0, 2, 3, 4, 5, 6, 7}) {
+        uint64_t directory[2];
+        std::memcpy(directory, bytes.data() + 64 + 16 * table, sizeof(directory));
+        ASSERT_GT(directory[1], 1u) << "table " << table;
+        std::string damaged = bytes;
+        uint32_t huge = 0x7fffffff;
+        std::memcpy(&damaged[directory[0] + 4 * (directory[1] / 2)], &huge, sizeof(huge));
+        write_file(damaged);
+        EXPECT_THROW(Forword{compiled_file}, std::runtime_error) << "table " << table;
+    }
+
+    // And headers whose max_pattern_length and window_size (at offsets 32
+    // and 40) are not the ones the patterns give, which would size the scan
+    // buffers: here the longest word is "badword", so 7 and 8
+    const uint64_t bad_lengths[][2] = {{1, uint64_t(1) << 40}, {7, 16}, {7, 4}, {8, 8}, {6, 8}, {0, 1}};
+    for (const auto& lengths : bad_lengths) {
+        std::string damaged = bytes;
+        std::memcpy(&damaged[32], lengths, sizeof(lengths));
+        write_file(damaged);
+        EXPECT_THROW(Forword{compiled_file}, std::runtime_error) << lengths[0] << " " << lengths[1];
+    }
+    write_file(bytes);
+    EXPECT_TRUE(Forword(compiled_file).search("bad"));
+
+    // Recompiling replaces the file instead of rewriting the pages a loaded
+    // dictionary still maps
+    Forword mapped(compiled_file);
+    std::ofstream(forbidden_words_file) << "xy\n";
+    Forword(forbidden_words_file).save_compiled(compiled_file);
+    EXPECT_EQ(mapped.replace("This is a b-a-d word"), "This is a ***");
+    EXPECT_FALSE(mapped.search("xy"));
+    Forword recompiled(compiled_file);
+    EXPECT_TRUE(recompiled.search("xy"));
+    EXPECT_FALSE(recompiled.search("bad"));
+    for (const auto& entry : std::filesystem::directory_iterator(temp_dir)) {
+        EXPECT_EQ(entry.path().filename().string().find(".tmp"), std::string::npos) << entry.path();
+    }
+}
+
+TEST_F(ForwordTest, ReloadableSwapsDictionary) {
+    Forword::Reloadable dictionary(forbidden_words_file);
+    EXPECT_TRUE(dictionary.search("this is bad"));
+    EXPECT_EQ(dictionary.generation(), 0u);
+
+    // Readers keep scanning while the dictionary flips back and forth
+    const std::string other_file = temp_dir + "/other_words.txt";
+    {
+        std::ofstream file(other_file);
+        file << "spam\nscam";
+    }
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> inconsistent{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; t++) {
+        readers.emplace_back([&] {
+            while (!stop.load()) {
+                // Both words come from the same snapshot
+                dictionary.with([&](const Forword& forword) {
+                    if (forword.search("bad") == forword.search("spam")) inconsistent++;
+                });
+            }
+        });
+    }
+    for (int i = 0; i < 20; i++) {
+        dictionary.reload(i % 2 == 0 ? other_file : forbidden_words_file);
+    }
+    stop = true;
+    for (auto& reader : readers) reader.join();
+    EXPECT_EQ(inconsistent.load(), 0u);
+    EXPECT_EQ(dictionary.generation(), 20u);
+
+    // A held snapshot survives later reloads
+    auto snapshot = dictionary.snapshot();
+    {
+        std::ofstream file(forbidden_words_file);
+        file << "scam";
+    }
+    dictionary.reload_async().get();
+    EXPECT_TRUE(snapshot->search("bad"));
+    EXPECT_FALSE(dictionary.search("bad"));
+    EXPECT_EQ(dictionary.replace("a scam here"), "a *** here");
+
+    // A failed reload keeps the current dictionary
+    EXPECT_THROW(dictionary.reload(temp_dir + "/missing.txt"), std::runtime_error);
+    EXPECT_TRUE(dictionary.search("scam"));
+    EXPECT_EQ(dictionary.generation(), 21u);
+}
+
+TEST_F(ForwordTest, IncrementalAddRemove) {
+    EXPECT_TRUE(forword->add_word("spam"));
+    EXPECT_TRUE(forword->add_word(" scam "));
+    EXPECT_FALSE(forword->add_word("SPAM"));
+    EXPECT_FALSE(forword->add_word("b-a-d"));
+    EXPECT_TRUE(forword->search("this is s.p.a.m"));
+    EXPECT_EQ(forword->word(forword->find_all("scam")[0].pattern_id), "scam");
+
+    EXPECT_TRUE(forword->remove_word("bad"));
+    EXPECT_FALSE(forword->remove_word("bad"));
+    EXPECT_FALSE(forword->search("so bad"));
+    EXPECT_TRUE(forword->search("badword"));
+    EXPECT_TRUE(forword->remove_word("spam"));
+    EXPECT_FALSE(forword->search("spam"));
+
+    // Same results as a dictionary built from scratch, before and after compact()
+    {
+        std::ofstream file(forbidden_words_file);
+        file << "badword\n나쁜말\n욕설\nscam";
+    }
+    Forword rebuilt(forbidden_words_file);
+    const char* texts[] = {"so bad", "a badword and a scam", "욕설 spam", "b a d w o r d s c a m"};
+    for (int round = 0; round < 2; round++) {
+        for (const char* text : texts) {
+            EXPECT_EQ(forword->search(text), rebuilt.search(text)) << text;
+            EXPECT_EQ(forword->replace(text), rebuilt.replace(text)) << text;
+            EXPECT_EQ(forword->find_all(text).size(), rebuilt.find_all(text).size()) << text;
+        }
+        forword->compact();
+    }
+    EXPECT_EQ(forword->word_count(), 4u);
+    EXPECT_TRUE(forword->add_word("bad"));
+    EXPECT_TRUE(forword->search("so bad"));
+
+    // Published to readers through a reloadable handle
+    Forword::Reloadable dictionary(forbidden_words_file);
+    dictionary.update([](Forword& f) { f.add_word("spam"); });
+    EXPECT_TRUE(dictionary.search("spam"));
+    EXPECT_EQ(dictionary.generation(), 1u);
+}
+
+TEST_F(ForwordTest, MemoryUsage) {
+    // bad, badword, 나쁜말, 욕설: 13 states, 12 edges, 4 patterns
+    auto usage = forword->memory_usage();
+    const size_t text_bytes = 3 + 7 + 9 + 6;
+    EXPECT_EQ(usage.automaton, 14 * 4 + 12 * 4 + 12 * 4 + 3 * 13 * 4 + 4 * 4 + 5 * 4 + text_bytes);
+    EXPECT_EQ(usage.delta, 0u);
+    EXPECT_EQ(usage.states, 13u);
+    EXPECT_FALSE(usage.mapped);
+
+    forword->add_word("spam");
+    EXPECT_GT(forword->memory_usage().delta, 0u);
+    EXPECT_EQ(forword->memory_usage().automaton, usage.automaton);
+
+    const std::string compiled_file = temp_dir + "/forbidden_words.fwd";
+    forword->save_compiled(compiled_file);
+    EXPECT_TRUE(Forword(compiled_file).memory_usage().mapped);
+}
+
+TEST_F(ForwordTest, ResultCache) {
+    Forword::Options options;
+    options.result_cache_entries = 60;
+    Forword cached(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, options);
+    EXPECT_EQ(cached.cache_stats().capacity, 64u);
+    EXPECT_EQ(forword->cache_stats().capacity, 0u);
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(cached.search("gg b-a-d"));
+        EXPECT_FALSE(cached.search("gg"));
+        EXPECT_EQ(cached.replace("gg b-a-d"), "gg ***");
+        EXPECT_EQ(cached.replace("gg b-a-d", "#"), "gg #");
+    }
+    auto stats = cached.cache_stats();
+    EXPECT_EQ(stats.misses, 4u);
+    EXPECT_EQ(stats.hits, 8u);
+    EXPECT_EQ(stats.entries, 4u);
+
+    // Every dictionary change invalidates
+    EXPECT_TRUE(cached.add_word("gg"));
+    EXPECT_TRUE(cached.search("gg"));
+    EXPECT_EQ(cached.replace("gg b-a-d"), "*** ***");
+    EXPECT_TRUE(cached.remove_word("bad"));
+    EXPECT_FALSE(cached.search("b-a-d"));
+    EXPECT_EQ(cached.replace("gg b-a-d"), "*** b-a-d");
+    EXPECT_TRUE(cached.add_word("bad"));
+    EXPECT_EQ(cached.replace("gg b-a-d"), "*** ***");
+    EXPECT_TRUE(cached.remove_word("gg"));
+    cached.compact();
+    EXPECT_FALSE(cached.search("gg"));
+
+    // Bounded, a hot message keeps its entry, long messages bypass
+    const uint64_t hits = cached.cache_stats().hits;
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(cached.search("spam " + std::to_string(i) + (i % 3 ? " bad" : "")), i % 3 != 0);
+        EXPECT_TRUE(cached.search("gg bad"));
+    }
+    stats = cached.cache_stats();
+    EXPECT_EQ(stats.entries, 64u);
+    EXPECT_GT(stats.evictions, 900u);
+    EXPECT_EQ(stats.hits, hits + 999);
+    std::string long_message(Forword::RESULT_CACHE_MAX_TEXT, 'x');
+    long_message += " bad";
+    EXPECT_TRUE(cached.search(long_message));
+    EXPECT_TRUE(cached.search(long_message));
+    EXPECT_EQ(cached.cache_stats().misses, stats.misses);
+    EXPECT_GT(stats.hit_rate(), 0.4);
+
+    // Concurrent callers agree with the uncached dictionary
+    std::vector<std::string> messages;
+    for (int i = 0; i < 200; i++) {
+        messages.push_back(std::to_string(i % 17) + (i % 5 ? u8" 나쁜 말" : " gg") + std::to_string(i % 23));
+    }
+    std::vector<std::thread> threads;
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 2000; i++) {
+                const std::string& message = messages[(i * 7 + t) % messages.size()];
+                if (cached.search(message) != forword->search(message) ||
+                    cached.replace(message) != forword->replace(message)) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_LE(cached.cache_stats().entries, 64u);
+}
+
+TEST_F(ForwordTest, StatsCompiledOutByDefault) {
+    forword->replace("so bad");
+    auto stats = forword->stats();
+    EXPECT_FALSE(stats.enabled);
+    EXPECT_EQ(stats.bytes_scanned, 0u);
+    EXPECT_TRUE(stats.matches_by_pattern.empty());
+}
+
+TEST_F(ForwordTest, BatchMatchesSingleCalls) {
+    const char* samples[] = {"This is a bad word", "clean message", "이것은 나쁜말 입니다", "",
+                             "b-a-d w.o.r.d and 욕설", "nothing", "BAD", "b a d"};
+    std::vector<std::string> texts;
+    for (int i = 0; i < 5000; i++) {
+        texts.push_back(std::string(samples[i % 8]) + " #" + std::to_string(i));
+    }
+
+    Forword::ThreadPool pool(4);
+    auto found = forword->search_batch(texts, pool);
+    auto replaced = forword->replace_batch(texts, pool);
+    ASSERT_EQ(found.size(), texts.size());
+    ASSERT_EQ(replaced.size(), texts.size());
+    for (size_t i = 0; i < texts.size(); i++) {
+        EXPECT_EQ(found[i], forword->search(texts[i])) << texts[i];
+        EXPECT_EQ(replaced[i], forword->replace(texts[i])) << texts[i];
+    }
+
+    std::vector<std::string_view> views{"bad", "good", "nope 욕설"};
+    EXPECT_EQ(forword->search_batch(views, pool), (std::vector<bool>{true, false, true}));
+    EXPECT_EQ(forword->replace_batch(views, pool, "#"), (std::vector<std::string>{"#", "good", "nope #"}));
+}
+
+TEST_F(ForwordTest, BatchSplitsHugeMessages) {
+    // Matches straddle the piece boundaries, padded with ignored symbols
+    const size_t split = Forword::BATCH_SPLIT_BYTES;
+    std::string huge(3 * split + 100, 'x');
+    huge.replace(split - 3, 9, "b..a..d..");
+    huge.replace(2 * split - 20, 40, "B-A-D word...........................!");
+    huge.replace(3 * split, 3, "bad");
+    std::string clean(2 * split + 7, 'y');
+    std::string tail_only(split + 10, 'z');
+    tail_only.replace(split + 4, 6, "나쁜말");
+
+    std::vector<std::string> texts{huge, "bad", clean, tail_only, "ok"};
+    Forword::ThreadPool pool(3);
+    auto found = forword->search_batch(texts, pool);
+    auto replaced = forword->replace_batch(texts, pool);
+    for (size_t i = 0; i < texts.size(); i++) {
+        EXPECT_EQ(found[i], forword->search(texts[i])) << i;
+        EXPECT_EQ(replaced[i], forword->replace(texts[i])) << i;
+    }
+    EXPECT_EQ(found, (std::vector<bool>{true, true, false, true, false}));
+}
+
+TEST_F(ForwordTest, BatchSplitMatchesFoldedExpansions) {
+    // ß folds to "ss", so "as" and "sb" both match inside "aßb" and share
+    // the bytes of ß; split pieces must resolve them as replace() does,
+    // also where ß straddles a piece boundary
+    std::ofstream(forbidden_words_file) << "as\nsb\n";
+    Forword dictionary(forbidden_words_file);
+    const size_t split = Forword::BATCH_SPLIT_BYTES;
+    const char* units[] = {u8"aßb", u8"ß", "a", "b", "s", " ", "x"};
+    std::mt19937 rng(11);
+    std::string huge;
+    while (huge.size() < 3 * split) huge += units[rng() % 7];
+    for (size_t boundary : {split, 2 * split}) {
+        huge.replace(boundary - 3, 8, u8"xaßbaßb");
+    }
+
+    std::vector<std::string> texts{huge, u8"aßb", u8"x aßb ßb"};
+    Forword::ThreadPool pool(3);
+    auto replaced = dictionary.replace_batch(texts, pool);
+    for (size_t i = 0; i < texts.size(); i++) {
+        EXPECT_TRUE(replaced[i] == dictionary.replace(texts[i])) << i;
+    }
+    EXPECT_EQ(replaced[1], "*** ***");
+}
+
+TEST_F(ForwordTest, BatchSplitMatchesReplace) {
+    // Overlapping words over a tiny alphabet, so every piece of a split
+    // message resolves thousands of competing matches, with words planted
+    // inside and across the piece boundaries
+    const size_t split = Forword::BATCH_SPLIT_BYTES;
+    const char* units[] = {"a", "b", "c", "ab", "bca", " ", "-", "x"};
+    std::mt19937 rng(5);
+    Forword::ThreadPool pool(3);
+
+    for (int round = 0; round < 4; round++) {
+        std::ofstream file(forbidden_words_file);
+        for (int w = 0, count = 2 + rng() % 6; w < count; w++) {
+            for (int k = 0, len = 1 + rng() % 5; k < len; k++) file << static_cast<char>('a' + rng() % 3);
+            file << "\n";
+        }
+        file << "qqqqqq\n";
+        file.close();
+
+        Forword dictionary = load_quietly(forbidden_words_file);
+
+        std::string huge;
+        while (huge.size() < 2 * split + 1000) huge += units[rng() % 8];
+        for (size_t boundary : {split, 2 * split}) {
+            huge.replace(boundary - 4 + round, 9, "abcab-cab");
+        }
+
+        std::vector<std::string> texts{huge, "abcabc", huge.substr(0, split + 17)};
+        auto replaced = dictionary.replace_batch(texts, pool);
+        for (size_t i = 0; i < texts.size(); i++) {
+            std::string expected = dictionary.replace(texts[i]);
+            ASSERT_EQ(replaced[i].size(), expected.size()) << round << " " << i;
+            EXPECT_TRUE(replaced[i] == expected) << round << " " << i;
+        }
+    }
+}
+
+TEST_F(ForwordTest, ScannerMatchesWholeText) {
+    const std::string texts[] = {
+        "This is a bad word",
+        "이것은 나쁜말 입니다. 그리고   욕설   끝",
+        "b-a-d w.o.r.d   and   ｂａｄ,   badbad  b  a  d",
+        "x \xed\x95 \xe4" "bad \xf0\x9f\x98\x80 욕설",
+        "   bad   ",
+        "clean message",
+    };
+    for (const std::string& text : texts) {
+        const std::string expected = forword->replace(text, "#");
+        const auto expected_matches = forword->find_all(text);
+        for (size_t chunk_size : {1, 2, 3, 5, 8, 64}) {
+            Forword::Scanner scanner(*forword, "#");
+            std::vector<Forword::Match> matches;
+            scanner.on_match([&](const Forword::Match& m) { matches.push_back(m); });
+            std::string out;
+            for (size_t i = 0; i < text.size(); i += chunk_size) {
+                scanner.feed(std::string_view(text).substr(i, chunk_size), out);
+            }
+            scanner.finish(out);
+            EXPECT_EQ(out, expected) << text << " / " << chunk_size;
+            EXPECT_EQ(scanner.found(), !expected_matches.empty());
+            ASSERT_EQ(matches.size(), expected_matches.size()) << text << " / " << chunk_size;
+            for (size_t k = 0; k < matches.size(); k++) {
+                EXPECT_EQ(matches[k].begin, expected_matches[k].begin);
+                EXPECT_EQ(matches[k].end, expected_matches[k].end);
+                EXPECT_EQ(matches[k].pattern_id, expected_matches[k].pattern_id);
+            }
+        }
+    }
+
+    Forword::Scanner detector(*forword);
+    detector.feed("this is b");
+    EXPECT_FALSE(detector.found());
+    detector.feed("-a-d");
+    detector.finish();
+    EXPECT_TRUE(detector.found());
+    std::string out;
+    EXPECT_THROW(detector.feed("bad", out), std::logic_error);
+}
+
+TEST_F(ForwordTest, ScanStateSpansMessages) {
+    Forword::ScanState state;
+    EXPECT_FALSE(forword->search_continue(state, "b"));
+    EXPECT_FALSE(forword->search_continue(state, "a"));
+    Forword::ScanState copy = state;
+    EXPECT_TRUE(forword->search_continue(state, "d"));
+    EXPECT_FALSE(forword->search_continue(state, "!"));  // reported once
+    EXPECT_TRUE(forword->search_continue(copy, "d!"));
+    copy.reset();
+    EXPECT_FALSE(forword->search_continue(copy, "d"));
+
+    state.reset();
+    EXPECT_EQ(forword->replace_continue(state, "so 나쁜"), "so 나쁜");
+    EXPECT_EQ(forword->replace_continue(state, "말 and b-"), "*** and b-");
+    EXPECT_EQ(forword->replace_continue(state, "a-d, ok"), "*** , ok");
+
+    // Any split of a text finds a word exactly when the whole text does
+    std::mt19937 rng(3);
+    const char* alphabet[] = {"b", "a", "d", "w", "o", "r", " ", u8"나", u8"쁜", u8"말", u8"욕", u8"설"};
+    for (int round = 0; round < 200; round++) {
+        std::string text;
+        Forword::ScanState split;
+        bool found = false;
+        for (size_t messages = rng() % 8; messages > 0; messages--) {
+            std::string message;
+            for (size_t k = rng() % 4; k > 0; k--) message += alphabet[rng() % 12];
+            found = forword->search_continue(split, message) || found;
+            text += message;
+        }
+        EXPECT_EQ(found, forword->search(text)) << text;
+    }
+
+    // Dictionary changes rebuild the position from the kept code points
+    state.reset();
+    EXPECT_FALSE(forword->search_continue(state, "x 욕"));
+    forword->add_word("zzz");
+    EXPECT_TRUE(forword->search_continue(state, "설"));
+    EXPECT_FALSE(forword->search_continue(state, "z z"));
+    forword->compact();
+    EXPECT_TRUE(forword->search_continue(state, "z"));
+
+    Forword::Reloadable dictionary(forbidden_words_file);
+    state.reset();
+    EXPECT_FALSE(dictionary.search_continue(state, "x 나쁜"));
+    dictionary.reload();
+    EXPECT_EQ(dictionary.replace_continue(state, "말"), "***");
+
+    // A minimized automaton needs the kept code points to name the word
+    Forword::Options options;
+    options.minimize = true;
+    std::ofstream(forbidden_words_file) << "나쁜말\n좋은말\n나쁜놈\n";
+    Forword minimized(forbidden_words_file, Forword::DEFAULT_IGNORED_SYMBOLS, options);
+    ASSERT_LT(minimized.memory_usage().states, minimized.memory_usage().trie_states);
+    state.reset();
+    EXPECT_FALSE(minimized.search_continue(state, "좋"));
+    EXPECT_FALSE(minimized.search_continue(state, "은"));
+    EXPECT_TRUE(minimized.search_continue(state, "말"));
+    EXPECT_TRUE(minimized.remove_word("좋은말"));
+    EXPECT_FALSE(minimized.search_continue(state, "좋은"));
+    EXPECT_FALSE(minimized.search_continue(state, "말"));
+    EXPECT_FALSE(minimized.search_continue(state, "나쁜"));
+    EXPECT_TRUE(minimized.search_continue(state, "놈"));
+}
+
 TEST_F(ForwordTest, EmptyInput) {
     EXPECT_FALSE(forword->search(""));
     EXPECT_EQ(forword->replace(""), "");
 }
 
+TEST_F(ForwordTest, InvalidUtf8Input) {
+    // Malformed bytes never match and are copied through unchanged
+    EXPECT_TRUE(forword->search("\xff\xfe bad"));
+    EXPECT_FALSE(forword->search("b\xc3" "d"));
+    EXPECT_EQ(forword->replace("\xff bad \xe4\xb8"), "\xff *** \xe4\xb8");
+}
+
 TEST_F(ForwordTest, WordsWithWhitespace) {
     // Create forbidden words file with whitespace
     std::ofstream file(forbidden_words_file);
@@ -134,6 +969,19 @@ TEST_F(ForwordTest, MultilingualSupport) {
     EXPECT_TRUE(forword.search(u8"这是一个坏话的例子"));
 }
 
+TEST_F(ForwordTest, WideAndUppercaseForms) {
+    std::ofstream file(forbidden_words_file);
+    file << u8"плохой\nnaïve\n";
+    file.close();
+
+    Forword forword(forbidden_words_file);
+
+    EXPECT_TRUE(forword.search(u8"Он ПЛОХОЙ"));
+    EXPECT_TRUE(forword.search(u8"ＮＡＩＶＥ"));
+    EXPECT_EQ(forword.replace(u8"so ＮＡÏＶＥ!"), u8"so *** !");
+    EXPECT_TRUE(this->forword->search(u8"ｂ－ａ－ｄ"));  // full-width symbols are ignored too
+}
+
 TEST_F(ForwordTest, DuplicateWordWarning) {
     // Create a temporary file with duplicate words (after normalization)
     std::ofstream file(forbidden_words_file);
@@ -174,6 +1022,58 @@ TEST_F(ForwordTest, DuplicateWordWarning) {
     EXPECT_TRUE(forword.search("This is scheisse"));      // Normalized version works
 }
 
+TEST_F(ForwordTest, EncodedWordLists) {
+    // UTF-16 and UTF-32 in both byte orders, with CRLF line ends, a
+    // character outside the BMP and enough ASCII for the block copy
+    const std::u32string words = U"bad\r\n나쁜말\n\n  😀욕설 \r\nabcdefghijklmnopqrstuvwxyz\n";
+    auto encode = [&](size_t unit_size, bool big_endian) {
+        std::string bytes;
+        auto put = [&](char32_t unit) {
+            for (size_t b = 0; b < unit_size; b++) {
+                size_t shift = 8 * (big_endian ? unit_size - 1 - b : b);
+                bytes.push_back(static_cast<char>((unit >> shift) & 0xFF));
+            }
+        };
+        put(0xFEFF);
+        for (char32_t ch : words) {
+            if (unit_size == 2 && ch >= 0x10000) {
+                put(0xD800 + ((ch - 0x10000) >> 10));
+                put(0xDC00 + ((ch - 0x10000) & 0x3FF));
+            } else {
+                put(ch);
+            }
+        }
+        return bytes;
+    };
+
+    for (auto [unit_size, big_endian] : {std::pair{2, false}, {2, true}, {4, false}, {4, true}}) {
+        {
+            std::ofstream file(forbidden_words_file, std::ios::binary);
+            file << encode(unit_size, big_endian);
+        }
+        Forword forword(forbidden_words_file);
+        SCOPED_TRACE(testing::Message() << unit_size << (big_endian ? " BE" : " LE"));
+        ASSERT_EQ(forword.word_count(), 4u);
+        EXPECT_EQ(forword.word(0), "bad");
+        EXPECT_EQ(forword.word(1), u8"나쁜말");
+        EXPECT_EQ(forword.word(2), u8"😀욕설");
+        EXPECT_EQ(forword.replace(u8"이건 나쁜말, 욕설, ABCDEFGHIJKLMNOPQRSTUVWXYZ"), u8"이건 *** , *** , ***");
+    }
+
+    // Unpaired surrogates and a truncated last unit don't break the rest
+    {
+        std::ofstream file(forbidden_words_file, std::ios::binary);
+        file << std::string("\xFF\xFE" "b\0a\0d\0\n\0" "\x00\xD8" "x\0\n\0" "\x00\xDC\n\0" "o\0k\0y", 25);
+    }
+    Forword broken(forbidden_words_file);
+    EXPECT_EQ(broken.word_count(), 3u);
+    EXPECT_TRUE(broken.search("bad"));
+    EXPECT_TRUE(broken.search("x"));
+    EXPECT_TRUE(broken.search("ok"));
+
+    EXPECT_THROW(Forword(temp_dir + "/missing.txt"), std::runtime_error);
+}
+
 TEST_F(ForwordTest, CustomIgnoredSymbols) {
     // 임시 금칙어 파일 생성
     std::string temp_file = temp_dir + "/custom_ignored_symbols.txt";
@@ -211,6 +1111,37 @@ TEST_F(ForwordTest, CustomIgnoredSymbols) {
         custom_forword.replace("This is b.a.d.w.o.r.d"));
 }
 
+TEST_F(ForwordTest, NonAsciiIgnoredSymbols) {
+    std::ofstream file(forbidden_words_file);
+    file << u8"나쁜말\n";
+    file.close();
+
+    // CJK punctuation and zero-width characters are ignored by default
+    Forword default_forword(forbidden_words_file);
+    EXPECT_TRUE(default_forword.search(u8"이건 나쁜、말"));
+    EXPECT_TRUE(default_forword.search(u8"이건 「나쁜」말"));
+    EXPECT_TRUE(default_forword.search(u8"이건 나​쁜‍말"));
+    EXPECT_EQ(default_forword.replace(u8"이건 나쁜。말!"), u8"이건 *** !");
+
+    // Symbols are whole code points: 、 does not also cover 。 or other
+    // characters sharing its UTF-8 lead byte
+    Forword ideographic_comma(forbidden_words_file, Forword::IgnoredSymbols(std::string_view(u8"、")));
+    EXPECT_TRUE(ideographic_comma.search(u8"나쁜、말"));
+    EXPECT_FALSE(ideographic_comma.search(u8"나쁜。말"));
+    EXPECT_FALSE(ideographic_comma.search(u8"나쁜-말"));
+
+    Forword::IgnoredSymbols emoji;
+    emoji.insert(U'-').insert(0x1F300, 0x1FAFF);
+    Forword emoji_forword(forbidden_words_file, emoji);
+    EXPECT_TRUE(emoji_forword.search(u8"나쁜🔥말"));
+    EXPECT_TRUE(emoji_forword.search(u8"나-쁜🤬말"));
+    EXPECT_FALSE(emoji_forword.search(u8"나쁜 말"));
+
+    EXPECT_TRUE(emoji.contains(0x1F600));
+    EXPECT_FALSE(emoji.contains(0x1FB00));
+    EXPECT_FALSE(emoji.contains(U'.'));
+}
+
 class NormalizeUtf8Test : public ::testing::Test {
 protected:
     static std::string normalize_utf8_test(const std::string& input) {
@@ -241,6 +1172,21 @@ TEST_F(NormalizeUtf8Test, BasicNormalization) {
     EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("über"), "uber");       // ü -> u
     EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("Mädchen"), "madchen"); // ä -> a
     EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("groß"), "gross");      // ß -> ss
+
+    // Test uppercase outside ASCII
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("ÀÉÎÕÜ"), "aeiou");
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("ПЛОХОЙ"), "плохои");  // Й -> й -> и
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("Łódź"), "łodz");      // Latin Extended-A
+
+    // Test compatibility forms
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("ＢＡＤ"), "bad");       // full-width Latin
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("ｂａｄ！"), "bad!");
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("ﾊﾞｶ"), "ハ\u3099カ");   // half-width katakana
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("ﬁne"), "fine");        // ligature expansion
+
+    // Test characters that must stay as they are
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("나쁜말"), "나쁜말");
+    EXPECT_EQ(NormalizeUtf8Test::normalize_utf8_test("ばか"), "ばか");
     
     // Print hex values for debugging
     std::string input = "cattività";
@@ -256,6 +1202,87 @@ TEST_F(NormalizeUtf8Test, BasicNormalization) {
     std::cout << std::endl;
 }
 
+class SimdScanTest : public ::testing::Test {
+protected:
+    using Level = Forword::SimdLevel;
+    using Emitted = std::vector<std::tuple<char32_t, size_t, size_t>>;
+
+    std::string forbidden_words_file;
+    std::unique_ptr<Forword> forword;
+
+    void SetUp() override {
+        forbidden_words_file = std::filesystem::temp_directory_path().string() + "/forword_simd_test.txt";
+        std::ofstream file(forbidden_words_file);
+        file << "bad\nbadword\nnaïve\n나쁜말\n";
+        file.close();
+        forword = std::make_unique<Forword>(forbidden_words_file);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(forbidden_words_file);
+    }
+
+    // Levels this CPU can run, scalar first
+    std::vector<Level> levels() const {
+        std::vector<Level> result{Level::None};
+        if (Forword::detect_simd_level() != Level::None) result.push_back(Level::SSE2);
+        if (Forword::detect_simd_level() == Level::AVX2) result.push_back(Level::AVX2);
+        return result;
+    }
+
+    void set_level(Level level) { forword->simd_level_ = level; }
+
+    Emitted normalized(const std::string& text) const {
+        Emitted out;
+        forword->for_each_normalized(text, [&](char32_t ch, size_t begin, size_t end) {
+            out.emplace_back(ch, begin, end);
+            return true;
+        });
+        return out;
+    }
+};
+
+TEST_F(SimdScanTest, LevelsAgree) {
+    const char* pieces[] = {"B", "a", "D", " ", "-", ".", "W", "o", "r", "d", "x", "Z", "!",
+                            "\t", "é", "ß", "나", "쁜", "말", "ï", "\xff", "@", "_", "9"};
+    uint32_t seed = 12345;
+    for (int round = 0; round < 200; round++) {
+        std::string text;
+        size_t pieces_count = round % 97;
+        for (size_t k = 0; k < pieces_count; k++) {
+            seed = seed * 1103515245 + 12345;
+            // Mostly ASCII so the vector blocks are exercised
+            size_t index = (seed >> 16) % (sizeof(pieces) / sizeof(pieces[0]));
+            if (index >= 14 && (seed & 3)) index %= 14;
+            text += pieces[index];
+        }
+
+        set_level(Level::None);
+        Emitted expected = normalized(text);
+        bool expected_found = forword->search(text);
+        std::string expected_replaced = forword->replace(text);
+
+        for (Level level : levels()) {
+            set_level(level);
+            EXPECT_EQ(normalized(text), expected) << text;
+            EXPECT_EQ(forword->search(text), expected_found) << text;
+            EXPECT_EQ(forword->replace(text), expected_replaced) << text;
+        }
+    }
+}
+
+TEST_F(SimdScanTest, LongAsciiMessage) {
+    std::string text(1000, 'x');
+    text += "B-A-D";
+    text += std::string(1000, 'y');
+
+    for (Level level : levels()) {
+        set_level(level);
+        EXPECT_TRUE(forword->search(text));
+        EXPECT_EQ(forword->replace(text), std::string(1000, 'x') + " *** " + std::string(1000, 'y'));
+    }
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
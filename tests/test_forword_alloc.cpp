@@ -0,0 +1,117 @@
+// Counts heap allocations by replacing the global operator new, so the
+// zero-allocation tests run in their own executable and the hook does not
+// reach the other tests.
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include "../forword.h"
+
+static std::atomic<size_t> allocations{0};
+static std::atomic<size_t> allocated_bytes{0};
+
+static void* counted_alloc(size_t size) {
+    allocations++;
+    allocated_bytes += size;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+// GCC cannot see that these pairs match and warns about free() on memory
+// from operator new
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void* operator new(size_t size) { return counted_alloc(size); }
+void* operator new[](size_t size) { return counted_alloc(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+class ForwordAllocTest : public ::testing::Test {
+protected:
+    std::string temp_dir;
+    std::unique_ptr<Forword> forword;
+
+    void SetUp() override {
+        temp_dir = std::filesystem::temp_directory_path().string() + "/forword_alloc_test";
+        std::filesystem::create_directory(temp_dir);
+        std::string forbidden_words_file = temp_dir + "/forbidden_words.txt";
+        std::ofstream file(forbidden_words_file);
+        file << "bad\nbadword\n나쁜말\n욕설";
+        file.close();
+
+        forword = std::make_unique<Forword>(forbidden_words_file);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(temp_dir);
+    }
+};
+
+TEST_F(ForwordAllocTest, ReusedBuffersDontAllocate) {
+    const std::string text = "This is a b-a-d word, 나쁜말! and more badword text";
+    std::string_view view(text);
+    std::string out;
+    Forword::Workspace workspace;
+    size_t matches = 0;
+    auto count = [&](const Forword::Match&) { matches++; };
+
+    // Warm up the buffers, then scan again without touching the heap
+    forword->replace_into(view, out);
+    forword->replace_into(view, out, "##", workspace);
+    forword->find_all(view, count);
+    forword->find_all(view, workspace, count);
+    const size_t before = allocations;
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(forword->search(view));
+        forword->replace_into(view, out);
+        forword->replace_into(view, out, "##", workspace);
+        forword->find_all(view, count);
+        forword->find_all(view, workspace, count);
+    }
+    EXPECT_EQ(allocations - before, 0u);
+
+    EXPECT_EQ(out, forword->replace(view, "##"));
+    forword->replace_into("", out);
+    EXPECT_EQ(out, "");
+    const size_t per_scan = forword->find_all(view).size();
+    EXPECT_EQ(matches, 2 * 101 * per_scan);
+
+    // Callbacks may scan again on the same thread
+    size_t inner = 0;
+    forword->find_all(view, [&](const Forword::Match&) { inner += forword->find_all(view).size(); });
+    EXPECT_EQ(inner, per_scan * per_scan);
+}
+
+TEST_F(ForwordAllocTest, CopiesShareFrozenTables) {
+    // Copies, as made by Reloadable::update(), share the main automaton,
+    // dense DFA and prefilter instead of copying them
+    std::string words_file = temp_dir + "/many_words.txt";
+    {
+        std::ofstream file(words_file);
+        for (int i = 0; i < 2000; i++) file << "word" << i << "x\n";
+    }
+    Forword::Options options;
+    options.dense_dfa_budget = 64 * 1024 * 1024;
+    Forword dictionary(words_file, Forword::DEFAULT_IGNORED_SYMBOLS, options);
+    Forword::MemoryUsage usage = dictionary.memory_usage();
+    ASSERT_GT(usage.dense_dfa, 0u);
+    ASSERT_GT(usage.prefilter, 0u);
+
+    const size_t before = allocated_bytes;
+    Forword copy(dictionary);
+    EXPECT_LT(allocated_bytes - before, (usage.automaton + usage.dense_dfa + usage.prefilter) / 10);
+
+    EXPECT_TRUE(copy.add_word("extra"));
+    EXPECT_TRUE(copy.search("w o r d 7 x and extra"));
+    EXPECT_FALSE(dictionary.search("extra"));
+    EXPECT_EQ(copy.memory_usage().dense_dfa, usage.dense_dfa);
+}
@@ -0,0 +1,97 @@
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using ForwordLib;
+
+// Smoke tests of the C# forwordd client against a real daemon. Build
+// forwordd with CMake and point FORWORDD at it; without it the tests are
+// reported as inconclusive.
+[TestClass]
+public class TestForwordClient
+{
+    private string tempDir = "";
+    private string socketPath = "";
+    private Process? daemon;
+
+    [TestInitialize]
+    public void Setup()
+    {
+        string? forwordd = Environment.GetEnvironmentVariable("FORWORDD");
+        if (string.IsNullOrEmpty(forwordd))
+        {
+            Assert.Inconclusive("Set FORWORDD to the forwordd binary to run the client tests");
+        }
+
+        tempDir = Path.GetTempPath() + "forword_client_test";
+        Directory.CreateDirectory(tempDir);
+        string forbiddenWordsFile = Path.Combine(tempDir, "forbidden_words.txt");
+        socketPath = Path.Combine(tempDir, "forwordd.sock");
+        File.WriteAllText(forbiddenWordsFile, "bad\nbadword\n나쁜말\n욕설");
+
+        daemon = Process.Start(new ProcessStartInfo(forwordd!, $"--threads 2 {forbiddenWordsFile} {socketPath}")
+        {
+            RedirectStandardOutput = true,
+        });
+        for (int i = 0; i < 100 && !File.Exists(socketPath); i++)
+        {
+            Thread.Sleep(50);
+        }
+        Assert.IsTrue(File.Exists(socketPath), "forwordd did not start");
+    }
+
+    [TestCleanup]
+    public void Cleanup()
+    {
+        if (daemon != null)
+        {
+            daemon.Kill();
+            daemon.WaitForExit();
+        }
+        if (Directory.Exists(tempDir))
+        {
+            Directory.Delete(tempDir, true);
+        }
+    }
+
+    [TestMethod]
+    public void TestSearchReplaceFindAll()
+    {
+        using var client = new ForwordClient(socketPath);
+        Assert.IsTrue(client.Search("This is a b-a-d word"));
+        Assert.IsFalse(client.Search("This is good"));
+        Assert.AreEqual("이것은 *** 입니다", client.Replace("이것은 나쁜말 입니다"));
+        Assert.AreEqual("##", client.Replace("욕설", "##"));
+
+        var matches = client.FindAll("x badword 나쁜말");
+        Assert.AreEqual(3, matches.Count);
+        Assert.AreEqual(new ForwordClient.Match(2, 5, 0, "bad"), matches[0]);
+        Assert.AreEqual(new ForwordClient.Match(10, 19, 2, "나쁜말"), matches[2]);
+    }
+
+    [TestMethod]
+    public void TestPipelinedBatches()
+    {
+        using var client = new ForwordClient(socketPath);
+        var messages = Enumerable.Range(0, 1000).Select(i => i % 3 == 0 ? $"msg {i} bad" : $"msg {i} ok").ToList();
+        // Non-ASCII messages take three UTF-8 bytes per character, so a
+        // window is limited by bytes rather than characters
+        messages.Add(new string('가', 200000) + " 욕설");
+        messages.Add(new string('나', 200000));
+
+        var found = client.SearchBatch(messages);
+        var replaced = client.ReplaceBatch(messages, "#");
+        Assert.AreEqual(messages.Count, found.Count);
+        for (int i = 0; i < 1000; i++)
+        {
+            Assert.AreEqual(i % 3 == 0, found[i]);
+            Assert.AreEqual(i % 3 == 0 ? $"msg {i} #" : $"msg {i} ok", replaced[i]);
+        }
+        Assert.IsTrue(found[1000]);
+        Assert.IsFalse(found[1001]);
+        Assert.AreEqual(new string('가', 200000) + " #", replaced[1000]);
+    }
+}
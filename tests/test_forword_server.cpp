@@ -0,0 +1,191 @@
+// forwordd's server and client talk over a real Unix domain socket here, so
+// these tests only build on POSIX systems.
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include "../forword_server.h"
+
+class ForwordServerTest : public ::testing::Test {
+protected:
+    std::string temp_dir;
+    std::string forbidden_words_file;
+    std::string socket_path;
+    std::unique_ptr<Forword::Reloadable> dictionary;
+    std::unique_ptr<ForwordServer> server;
+    std::thread server_thread;
+
+    void SetUp() override {
+        temp_dir = std::filesystem::temp_directory_path().string() + "/forword_server_test";
+        std::filesystem::create_directory(temp_dir);
+        forbidden_words_file = temp_dir + "/forbidden_words.txt";
+        socket_path = temp_dir + "/forwordd.sock";
+
+        std::ofstream file(forbidden_words_file);
+        file << "bad\nbadword\n나쁜말\n욕설";
+        file.close();
+
+        ForwordServer::Options options;
+        options.threads = 2;
+        dictionary = std::make_unique<Forword::Reloadable>(forbidden_words_file);
+        server = std::make_unique<ForwordServer>(*dictionary, socket_path, options);
+        server_thread = std::thread([this] { server->run(); });
+    }
+
+    void TearDown() override {
+        server->stop();
+        server_thread.join();
+        server.reset();
+        std::filesystem::remove_all(temp_dir);
+    }
+};
+
+TEST_F(ForwordServerTest, MatchesLocalDictionary) {
+    ForwordClient client(socket_path);
+    Forword local(forbidden_words_file);
+
+    EXPECT_TRUE(client.search("This is a b-a-d word"));
+    EXPECT_FALSE(client.search("This is good"));
+    EXPECT_FALSE(client.search(""));
+    EXPECT_EQ(client.replace("이것은 나쁜말 입니다"), "이것은 *** 입니다");
+    EXPECT_EQ(client.replace("bad and 욕설", "##"), local.replace("bad and 욕설", "##"));
+
+    std::string text = "x badword y 나 쁜 말";
+    std::vector<ForwordClient::Match> remote = client.find_all(text);
+    std::vector<Forword::Match> expected = local.find_all(text);
+    ASSERT_EQ(remote.size(), expected.size());
+    for (size_t i = 0; i < remote.size(); i++) {
+        EXPECT_EQ(remote[i].begin, expected[i].begin);
+        EXPECT_EQ(remote[i].end, expected[i].end);
+        EXPECT_EQ(remote[i].pattern_id, expected[i].pattern_id);
+        EXPECT_EQ(remote[i].word, local.word(expected[i].pattern_id));
+    }
+}
+
+TEST_F(ForwordServerTest, PipelinedBatchesKeepOrder) {
+    ForwordClient client(socket_path);
+    Forword local(forbidden_words_file);
+    std::mt19937 rng(5);
+    const char* alphabet[] = {"b", "a", "d", "w", "o", "r", " ", "-", u8"나", u8"쁜", u8"말", u8"욕", u8"설"};
+
+    std::vector<std::string> messages(1000);
+    for (std::string& message : messages) {
+        for (size_t k = rng() % 12; k > 0; k--) message += alphabet[rng() % 13];
+    }
+    messages.push_back(std::string(3 * 1024 * 1024, 'x') + "bad");  // a window of its own
+
+    std::vector<bool> found = client.search_batch(messages);
+    std::vector<std::string> replaced = client.replace_batch(messages, "<>");
+    ASSERT_EQ(found.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); i++) {
+        EXPECT_EQ(found[i], local.search(messages[i])) << messages[i];
+        EXPECT_EQ(replaced[i], local.replace(messages[i], "<>")) << messages[i];
+    }
+
+    // Pipelined requests arrive together and are scanned together
+    ForwordServer::Stats stats = server->stats();
+    EXPECT_EQ(stats.requests, 2 * messages.size());
+    EXPECT_LT(stats.batches * 10, stats.requests);
+}
+
+TEST_F(ForwordServerTest, ConcurrentClients) {
+    Forword local(forbidden_words_file);
+    std::vector<std::thread> threads;
+    std::atomic<size_t> mismatches{0};
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t] {
+            ForwordClient client(socket_path);
+            std::mt19937 rng(t);
+            for (int i = 0; i < 200; i++) {
+                std::string message = "msg " + std::to_string(rng() % 100) + (rng() % 3 ? " b a d" : " ok");
+                if (client.search(message) != local.search(message)) mismatches++;
+                if (client.replace(message) != local.replace(message)) mismatches++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0u);
+    EXPECT_EQ(server->stats().connections, 4u);
+}
+
+TEST_F(ForwordServerTest, ReloadTakesEffect) {
+    ForwordClient client(socket_path);
+    EXPECT_FALSE(client.search("spam"));
+    std::ofstream(forbidden_words_file) << "spam\n";
+    dictionary->reload();
+    EXPECT_TRUE(client.search("s p a m"));
+    EXPECT_FALSE(client.search("bad"));
+}
+
+TEST_F(ForwordServerTest, OversizedResponses) {
+    // Requests under MAX_FRAME whose answers are not: every "bad" costs a
+    // find_all 19 bytes and a replace 100
+    ForwordClient client(socket_path);
+    std::string dense;
+    for (size_t i = 0; i < ForwordClient::MAX_FRAME / 16; i++) dense += "bad";
+    EXPECT_THROW(client.find_all(dense), std::runtime_error);
+    EXPECT_TRUE(client.search("bad"));
+
+    std::string spaced;
+    for (size_t i = 0; i < ForwordClient::MAX_FRAME / 100 + 1000; i++) spaced += "bad ";
+    EXPECT_THROW(client.replace(spaced, std::string(99, '#')), std::runtime_error);
+    EXPECT_EQ(client.replace("so bad"), "so ***");
+
+    std::string frame;
+    size_t start = ForwordClient::begin_frame(frame, 1, 0);
+    frame.resize(start + 4 + ForwordClient::MAX_FRAME + 1);
+    EXPECT_THROW(ForwordClient::end_frame(frame, start), std::length_error);
+}
+
+TEST_F(ForwordServerTest, BadRequests) {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+    ASSERT_EQ(::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)), 0);
+
+    // An unknown op and a truncated replace are answered with errors, in order
+    std::string frames;
+    size_t start = ForwordClient::begin_frame(frames, 7, 99);
+    ForwordClient::end_frame(frames, start);
+    start = ForwordClient::begin_frame(frames, 8, static_cast<uint8_t>(ForwordClient::Op::Replace));
+    ForwordClient::put_u32(frames, 100);
+    frames += "bad";
+    ForwordClient::end_frame(frames, start);
+    start = ForwordClient::begin_frame(frames, 9, static_cast<uint8_t>(ForwordClient::Op::Search));
+    frames += "bad";
+    ForwordClient::end_frame(frames, start);
+    ASSERT_EQ(::send(fd, frames.data(), frames.size(), 0), static_cast<ssize_t>(frames.size()));
+
+    std::string in;
+    char buffer[256];
+    while (in.size() < 3 * (4 + ForwordClient::FRAME_HEADER) + 1) {
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        ASSERT_GT(n, 0);
+        in.append(buffer, static_cast<size_t>(n));
+    }
+    std::vector<std::pair<uint32_t, char>> responses;  // id, status
+    for (size_t p = 0; p + 4 <= in.size(); p += 4 + ForwordClient::get_u32(in.data() + p)) {
+        responses.emplace_back(ForwordClient::get_u32(in.data() + p + 4), in[p + 8]);
+    }
+    ASSERT_EQ(responses.size(), 3u);
+    EXPECT_EQ(responses[0], std::make_pair(7u, static_cast<char>(ForwordClient::Status::Error)));
+    EXPECT_EQ(responses[1], std::make_pair(8u, static_cast<char>(ForwordClient::Status::Error)));
+    EXPECT_EQ(responses[2], std::make_pair(9u, static_cast<char>(ForwordClient::Status::Ok)));
+    EXPECT_EQ(in.back(), 1);
+
+    // A frame over MAX_FRAME drops the connection
+    frames.clear();
+    ForwordClient::put_u32(frames, ForwordClient::MAX_FRAME + 1);
+    ::send(fd, frames.data(), frames.size(), 0);
+    EXPECT_EQ(::recv(fd, buffer, sizeof(buffer), 0), 0);
+    ::close(fd);
+
+    // A second daemon on the same socket is refused
+    EXPECT_THROW(ForwordServer(*dictionary, socket_path), std::runtime_error);
+    ForwordClient client(socket_path);
+    EXPECT_TRUE(client.search("bad"));
+}
@@ -0,0 +1,89 @@
+// Statistics are compiled in only with FORWORD_ENABLE_STATS, so they are
+// tested in their own executable.
+#define FORWORD_ENABLE_STATS
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "../forword.h"
+
+class ForwordStatsTest : public ::testing::Test {
+protected:
+    std::string temp_dir;
+    std::unique_ptr<Forword> forword;
+
+    void SetUp() override {
+        temp_dir = std::filesystem::temp_directory_path().string() + "/forword_stats_test";
+        std::filesystem::create_directory(temp_dir);
+        std::string forbidden_words_file = temp_dir + "/forbidden_words.txt";
+        std::ofstream file(forbidden_words_file);
+        file << "bad\nbadword\n나쁜말\n욕설";
+        file.close();
+
+        forword = std::make_unique<Forword>(forbidden_words_file);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(temp_dir);
+    }
+};
+
+TEST_F(ForwordStatsTest, CountsScanWork) {
+    auto stats = forword->stats();
+    EXPECT_TRUE(stats.enabled);
+    EXPECT_EQ(stats.phase(Forword::Phase::Build).calls, 1u);
+    EXPECT_EQ(stats.bytes_scanned, 0u);
+    ASSERT_EQ(stats.matches_by_pattern.size(), 4u);
+
+    EXPECT_TRUE(forword->search("b-a-d"));
+    stats = forword->stats();
+    EXPECT_EQ(stats.bytes_scanned, 5u);
+    EXPECT_EQ(stats.ignored_code_points, 2u);
+    EXPECT_EQ(stats.phase(Forword::Phase::Scan).calls, 1u);
+
+    // "bab" falls back from "ba" to the root before taking "b" again
+    forword->reset_stats();
+    auto matches = forword->find_all("babad badword 나쁜말");
+    ASSERT_EQ(matches.size(), 4u);
+    stats = forword->stats();
+    EXPECT_GE(stats.fail_transitions, 1u);
+    EXPECT_EQ(stats.matches, 4u);
+    EXPECT_EQ(stats.matches_by_pattern[0], 2u);  // bad
+    EXPECT_EQ(stats.matches_by_pattern[1], 1u);  // badword
+    EXPECT_EQ(stats.matches_by_pattern[2], 1u);  // 나쁜말
+    EXPECT_EQ(stats.phase(Forword::Phase::Build).calls, 0u);
+
+    EXPECT_EQ(forword->replace("so bad"), "so ***");
+    stats = forword->stats();
+    const auto& replace = stats.phase(Forword::Phase::Replace);
+    EXPECT_EQ(replace.calls, 1u);
+    uint64_t bucketed = 0;
+    for (uint64_t calls : replace.buckets) bucketed += calls;
+    EXPECT_EQ(bucketed, 1u);
+
+    // Added words get their own counter
+    forword->add_word("spam");
+    forword->find_all("spam");
+    EXPECT_EQ(forword->stats().matches_by_pattern.at(4), 1u);
+    EXPECT_EQ(forword->stats().matches_by_pattern.at(0), 3u);  // kept across the resize
+}
+
+TEST_F(ForwordStatsTest, ShardedAcrossThreads) {
+    const std::string text = "clean text with one bad word";
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 500; i++) forword->replace(text);
+        });
+    }
+    // Reading while the workers count is fine
+    while (forword->stats().phase(Forword::Phase::Replace).calls < 2000 && !threads.empty()) {
+        std::this_thread::yield();
+    }
+    for (auto& thread : threads) thread.join();
+
+    auto stats = forword->stats();
+    EXPECT_EQ(stats.phase(Forword::Phase::Replace).calls, 2000u);
+    EXPECT_EQ(stats.bytes_scanned, 2000u * text.size());
+    EXPECT_EQ(stats.matches_by_pattern[0], 2000u);
+}
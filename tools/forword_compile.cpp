@@ -0,0 +1,24 @@
+// Compiles a forbidden words file into a binary dictionary that Forword
+// maps at startup instead of parsing and building the automaton again.
+//
+// Usage: forword_compile <forbidden_words.txt> <output.fwd>
+#include <exception>
+#include <iostream>
+#include "../forword.h"
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <forbidden_words.txt> <output.fwd>\n";
+        return 2;
+    }
+
+    try {
+        Forword forword(argv[1]);
+        forword.save_compiled(argv[2]);
+        std::cout << "Compiled " << forword.word_count() << " words to " << argv[2] << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "forword_compile: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
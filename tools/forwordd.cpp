@@ -0,0 +1,85 @@
+// Serves one Forword dictionary to every process on the host over a Unix
+// domain socket (see forword_server.h, and forword_client.h for the wire
+// format and the C++ client). SIGHUP reloads the dictionary file; SIGINT
+// and SIGTERM shut the daemon down.
+//
+// Usage: forwordd [--threads N] [--cache N] <forbidden_words.txt|.fwd> <socket>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include "../forword_server.h"
+
+int main(int argc, char* argv[]) {
+    ForwordServer::Options server_options;
+    Forword::Options options;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "--threads" || arg == "--cache") && i + 1 < argc) {
+            size_t value = std::strtoull(argv[++i], nullptr, 10);
+            (arg == "--threads" ? server_options.threads : options.result_cache_entries) = value;
+        } else {
+            paths.push_back(arg);
+        }
+    }
+    if (paths.size() != 2) {
+        std::cerr << "Usage: " << argv[0] << " [--threads N] [--cache N] <forbidden_words.txt|.fwd> <socket>\n";
+        return 2;
+    }
+
+    // Signals are taken by one thread with sigwait(), so reload() and stop()
+    // run as ordinary code rather than in a handler
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGHUP);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    try {
+        Forword::Reloadable dictionary(paths[0], Forword::DEFAULT_IGNORED_SYMBOLS, options);
+        ForwordServer server(dictionary, paths[1], server_options);
+        std::cout << "forwordd: serving " << dictionary.snapshot()->word_count() << " words on " << paths[1] << std::endl;
+
+        std::thread signal_thread([&] {
+            for (;;) {
+                int signal = 0;
+                sigwait(&signals, &signal);
+                if (signal != SIGHUP) break;
+                try {
+                    dictionary.reload();
+                    std::cout << "forwordd: reloaded " << dictionary.snapshot()->word_count() << " words" << std::endl;
+                } catch (const std::exception& e) {
+                    std::cerr << "forwordd: reload failed, keeping the old dictionary: " << e.what() << std::endl;
+                }
+            }
+            server.stop();
+        });
+
+        // Releases and joins the signal thread however run() ends, including
+        // when it throws
+        struct SignalThreadGuard {
+            std::thread& thread;
+            ~SignalThreadGuard() {
+                ::kill(::getpid(), SIGTERM);
+                thread.join();
+            }
+        };
+        {
+            SignalThreadGuard guard{signal_thread};
+            server.run();
+        }
+        ForwordServer::Stats stats = server.stats();
+        std::cout << "forwordd: answered " << stats.requests << " requests in " << stats.batches << " batches" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "forwordd: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Generate forword_fold_table.h, the case/accent/compatibility folding table.
+
+Every code point is folded the same way for dictionary words and messages:
+
+1. Compatibility mapping for width and font variants (full-width Latin,
+   half-width katakana, mathematical and circled letters) and Latin
+   ligatures. Other compatibility mappings are left alone.
+2. Full Unicode case folding (so ß -> ss, Cyrillic/Greek uppercase -> lowercase).
+3. Canonical decomposition with the combining diacritical marks
+   U+0300..U+036F removed, then recomposition (so é -> e, but Japanese
+   voiced kana keep their dakuten).
+
+The result is emitted as a two-level table: stage1 maps the high bits of a
+code point to a 256-entry block of stage2, and stage2 holds indices into a
+small table of distinct fold values. Identical blocks are shared.
+
+Usage: python3 tools/gen_fold_table.py [forword_fold_table.h]
+"""
+
+import sys
+import unicodedata
+
+COMPAT_TAGS = ("<wide>", "<narrow>", "<font>", "<circle>")
+LIGATURES = range(0xFB00, 0xFB07)
+MAX_EXPANSION = 3
+BLOCK = 256
+MAX_CP = 0x110000
+
+
+def fold(cp):
+    ch = chr(cp)
+    decomposition = unicodedata.decomposition(ch)
+    if decomposition.startswith(COMPAT_TAGS) or cp in LIGATURES:
+        ch = unicodedata.normalize("NFKC", ch)
+    ch = ch.casefold()
+    ch = unicodedata.normalize("NFD", ch)
+    ch = "".join(c for c in ch if not 0x0300 <= ord(c) <= 0x036F)
+    return unicodedata.normalize("NFC", ch)
+
+
+def fold_value(cp):
+    # Surrogates and Hangul syllables are never folded
+    if 0xD800 <= cp <= 0xDFFF or 0xAC00 <= cp <= 0xD7A3:
+        return (0, 1, ())
+    folded = fold(cp)
+    if folded == chr(cp) or len(folded) > MAX_EXPANSION:
+        return (0, 1, ())
+    if len(folded) == 1:
+        return (ord(folded) - cp, 1, ())
+    return (0, len(folded), tuple(ord(c) for c in folded))
+
+
+def main():
+    values = [(0, 1, ())]          # index 0 is identity
+    value_index = {values[0]: 0}
+    blocks = []
+    block_index = {}
+    stage1 = []
+
+    for base in range(0, MAX_CP, BLOCK):
+        block = []
+        for cp in range(base, base + BLOCK):
+            value = fold_value(cp)
+            if value not in value_index:
+                value_index[value] = len(values)
+                values.append(value)
+            block.append(value_index[value])
+        block = tuple(block)
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+
+    out = open(sys.argv[1], "w", encoding="utf-8") if len(sys.argv) > 1 else sys.stdout
+    out.write("// Generated by tools/gen_fold_table.py from Unicode %s. Do not edit.\n"
+              % unicodedata.unidata_version)
+    out.write("#ifndef FORWORD_FOLD_TABLE_H\n#define FORWORD_FOLD_TABLE_H\n\n")
+    out.write("#include <cstdint>\n\n")
+    out.write("namespace forword_fold {\n\n")
+    out.write("// Folded form of a code point: length 0 drops it, length 1 adds delta\n")
+    out.write("// to it, and longer results are spelled out in chars.\n")
+    out.write("struct Value {\n    int32_t delta;\n    uint32_t length;\n"
+              "    char32_t chars[%d];\n};\n\n" % MAX_EXPANSION)
+    out.write("inline constexpr uint32_t BLOCK_SHIFT = 8;\n")
+    out.write("inline constexpr uint32_t MAX_EXPANSION = %d;\n" % MAX_EXPANSION)
+    out.write("inline constexpr char UNICODE_VERSION[] = \"%s\";\n\n" % unicodedata.unidata_version)
+
+    out.write("inline constexpr Value values[%d] = {\n" % len(values))
+    for delta, length, chars in values:
+        padded = list(chars) + [0] * (MAX_EXPANSION - len(chars))
+        out.write("    {%d, %d, {%s}},\n" % (delta, length, ", ".join("0x%X" % c for c in padded)))
+    out.write("};\n\n")
+
+    def write_array(name, ctype, data):
+        out.write("inline constexpr %s %s[%d] = {\n" % (ctype, name, len(data)))
+        for i in range(0, len(data), 16):
+            out.write("    " + ", ".join(str(v) for v in data[i:i + 16]) + ",\n")
+        out.write("};\n\n")
+
+    write_array("stage1", "uint16_t", stage1)
+    write_array("stage2", "uint16_t", [v for block in blocks for v in block])
+
+    out.write("inline const Value& lookup(char32_t cp) {\n")
+    out.write("    return values[stage2[(stage1[cp >> BLOCK_SHIFT] << BLOCK_SHIFT) | (cp & 0xFF)]];\n")
+    out.write("}\n\n")
+    out.write("} // namespace forword_fold\n\n#endif // FORWORD_FOLD_TABLE_H\n")
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()